@@ -1,6 +1,9 @@
 #include "../engine/engine.h"
 #include "../engine/Gaddag.h"
 #include "../engine/MoveGenerator.h"
+#include "../engine/SuccinctGaddag.h"
+#include "../engine/LazyGaddag.h"
+#include "../engine/Instrumentation.h"
 #include <iostream>
 #include <fstream>
 #include <vector>
@@ -8,6 +11,9 @@
 #include <chrono>
 #include <sstream>
 #include <iomanip>
+#include <algorithm>
+#include <memory>
+#include <sys/stat.h>
 
 using namespace Scrabble;
 
@@ -43,6 +49,23 @@ std::vector<BenchmarkCase> loadBenchmarks(const std::string& path) {
     return cases;
 }
 
+// Sorted (row, col, word) of each move, to compare move sets produced in different orders
+std::vector<std::string> moveKeys(const std::vector<Move>& moves) {
+    std::vector<std::string> keys;
+    for (const Move& m : moves) keys.push_back(std::to_string(m.row) + "," + std::to_string(m.col) + "," + m.word);
+    std::sort(keys.begin(), keys.end());
+    return keys;
+}
+
+// The paged file is derived from the word list: reuse it only if it is newer than the list and still opens
+bool lazyFileCurrent(const std::string& lazyPath, const std::string& dictPath) {
+    struct stat lazy, dict;
+    if (stat(lazyPath.c_str(), &lazy) != 0 || stat(dictPath.c_str(), &dict) != 0) return false;
+    if (lazy.st_mtime < dict.st_mtime) return false;
+    LazyGaddag probe;
+    return probe.open(lazyPath, false);
+}
+
 void setupBoard(Board& board, const std::string& boardStr) {
     int idx = 0;
     for (int r = 0; r < 15; ++r) {
@@ -104,7 +127,9 @@ int main() {
     std::cout << std::left << std::setw(5) << "#" 
               << std::setw(15) << "Rack" 
               << std::setw(10) << "Moves" 
-              << std::setw(10) << "Time(us)" << std::endl;
+              << std::setw(10) << "Time(us)";
+    if (INSTRUMENTATION_ENABLED) std::cout << std::setw(12) << "Nodes";
+    std::cout << std::endl;
     std::cout << std::string(40, '-') << std::endl;
 
     for (size_t i = 0; i < cases.size(); ++i) {
@@ -116,6 +141,7 @@ int main() {
         // Warmup? No, we want raw cold/warm performance depending on cache. 
         // Single run per position is fine for macro benchmark.
 
+        GenCounters before = threadCounters();
         tStart = std::chrono::high_resolution_clock::now();
         std::vector<Move> moves = generator.generateMoves(board, rack, gaddag);
         
@@ -143,7 +169,9 @@ int main() {
         std::cout << std::left << std::setw(5) << i 
                   << std::setw(15) << cases[i].rackStr 
                   << std::setw(10) << moves.size() 
-                  << std::setw(10) << us << std::endl;
+                  << std::setw(10) << us;
+        if (INSTRUMENTATION_ENABLED) std::cout << std::setw(12) << threadCounters().nodesVisited - before.nodesVisited;
+        std::cout << std::endl;
     }
 
     std::cout << std::string(40, '-') << std::endl;
@@ -152,5 +180,151 @@ int main() {
     double avgTime = cases.empty() ? 0 : (double)totalDurationUs / cases.size();
     std::cout << "Average Time per Position: " << avgTime << " us" << std::endl;
 
+    if (INSTRUMENTATION_ENABLED) {
+        std::cout << "\nGenerator counters:" << std::endl;
+        printCounters(std::cout, collectCounters());
+    }
+
+    // 3. Succinct GADDAG: size, and traversal speed against the pointer GADDAG
+    std::cout << "\n=== Succinct GADDAG ===" << std::endl;
+    tStart = std::chrono::high_resolution_clock::now();
+    SuccinctGaddag succinct(gaddag);
+    tEnd = std::chrono::high_resolution_clock::now();
+    double words = std::max<uint32_t>(1, succinct.wordCount());
+    size_t pointerBytes = gaddag.bytes();
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "Encoded " << succinct.nodeCount() << " nodes, " << succinct.wordCount() << " words in "
+              << std::chrono::duration_cast<std::chrono::milliseconds>(tEnd - tStart).count() << " ms." << std::endl;
+    std::cout << "Pointer GADDAG:  " << pointerBytes / (1024.0 * 1024.0) << " MB, "
+              << pointerBytes / words << " bytes/word" << std::endl;
+    std::cout << "Succinct GADDAG: " << succinct.bytes() / (1024.0 * 1024.0) << " MB, "
+              << succinct.bytes() / words << " bytes/word" << std::endl;
+
+    // Same traversal from both, best of three passes each
+    GenContext context;
+    long long pointerUs = 0, succinctUs = 0;
+    size_t mismatches = 0;
+    for (size_t i = 0; i < cases.size(); ++i) {
+        Board board;
+        setupBoard(board, cases[i].boardStr);
+        std::vector<char> rack(cases[i].rackStr.begin(), cases[i].rackStr.end());
+        long long best[2] = {-1, -1};
+        std::vector<std::string> found[2];
+        for (int pass = 0; pass < 3; ++pass) {
+            for (int kind = 0; kind < 2; ++kind) {
+                auto t0 = std::chrono::high_resolution_clock::now();
+                const std::vector<Move>& moves = kind == 0 ? generator.generateMoves(board, rack, gaddag, context)
+                                                           : generator.generateMoves(board, rack, succinct, context);
+                auto t1 = std::chrono::high_resolution_clock::now();
+                long long us = std::chrono::duration_cast<std::chrono::microseconds>(t1 - t0).count();
+                if (best[kind] < 0 || us < best[kind]) best[kind] = us;
+                if (pass == 0) found[kind] = moveKeys(moves);
+            }
+        }
+        pointerUs += best[0];
+        succinctUs += best[1];
+        if (found[0] != found[1]) mismatches++;
+    }
+    std::cout << "Traversal: pointer " << pointerUs << " us, succinct " << succinctUs << " us ("
+              << (pointerUs > 0 ? (double)succinctUs / pointerUs : 0.0) << "x the pointer time)" << std::endl;
+    if (mismatches > 0) {
+        std::cerr << "Succinct GADDAG moves differ on " << mismatches << " positions" << std::endl;
+        return 1;
+    }
+
+    // 4. Interleaved traversal: several anchors in flight with prefetching, against the recursion
+    std::cout << "\n=== Interleaved Traversal ===" << std::endl;
+    long long recursiveUs = 0, interleavedUs = 0;
+    size_t interleavedMoves = 0;
+    mismatches = 0;
+    for (size_t i = 0; i < cases.size(); ++i) {
+        Board board;
+        setupBoard(board, cases[i].boardStr);
+        std::vector<char> rack(cases[i].rackStr.begin(), cases[i].rackStr.end());
+        long long best[2] = {-1, -1};
+        std::vector<std::string> found[2];
+        for (int pass = 0; pass < 3; ++pass) {
+            for (int kind = 0; kind < 2; ++kind) {
+                auto t0 = std::chrono::high_resolution_clock::now();
+                const std::vector<Move>& moves = kind == 0 ? generator.generateMoves(board, rack, gaddag, context)
+                                                           : generator.generateMovesInterleaved(board, rack, gaddag, context);
+                auto t1 = std::chrono::high_resolution_clock::now();
+                long long us = std::chrono::duration_cast<std::chrono::microseconds>(t1 - t0).count();
+                if (best[kind] < 0 || us < best[kind]) best[kind] = us;
+                if (pass == 0) found[kind] = moveKeys(moves);
+            }
+        }
+        recursiveUs += best[0];
+        interleavedUs += best[1];
+        interleavedMoves += found[1].size();
+        if (found[0] != found[1]) mismatches++;
+    }
+    double seconds[2] = {recursiveUs / 1e6, interleavedUs / 1e6};
+    std::cout << "Recursive:   " << recursiveUs << " us (" << (seconds[0] > 0 ? interleavedMoves / seconds[0] : 0.0)
+              << " moves/s)" << std::endl;
+    std::cout << "Interleaved: " << interleavedUs << " us (" << (seconds[1] > 0 ? interleavedMoves / seconds[1] : 0.0)
+              << " moves/s, " << (interleavedUs > 0 ? (double)recursiveUs / interleavedUs : 0.0) << "x)" << std::endl;
+    if (mismatches > 0) {
+        std::cerr << "Interleaved traversal moves differ on " << mismatches << " positions" << std::endl;
+        return 1;
+    }
+
+    auto ms = [](std::chrono::high_resolution_clock::time_point from) {
+        return std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - from).count();
+    };
+
+    // 5. Dictionary lifecycle: nodes come from an arena, so a graph is freed block by block
+    std::cout << "\n=== Dictionary Lifecycle ===" << std::endl;
+    {
+        auto t0 = std::chrono::high_resolution_clock::now();
+        std::unique_ptr<Gaddag> built(new Gaddag());
+        if (!built->loadFromFile(dictPath)) return 1;
+        double construction = ms(t0);
+        t0 = std::chrono::high_resolution_clock::now();
+        if (!built->loadBinary(binPath)) return 1;
+        double reload = ms(t0);
+        t0 = std::chrono::high_resolution_clock::now();
+        built.reset();
+        double shutdown = ms(t0);
+        std::cout << "Construction from text: " << construction << " ms" << std::endl;
+        std::cout << "Reload from binary:     " << reload << " ms (drops the previous graph)" << std::endl;
+        std::cout << "Shutdown:               " << shutdown << " ms" << std::endl;
+    }
+
+    // 6. Lazy loading: time to the first answer vs. time until the whole dictionary is in memory
+    std::cout << "\n=== Lazy Loading ===" << std::endl;
+    std::string lazyPath = "assets/dictionnaries/french.lazy";
+    if (!lazyFileCurrent(lazyPath, dictPath) && !LazyGaddag::savePaged(gaddag, lazyPath)) return 1;
+    if (cases.empty()) return 0;
+    Board first;
+    setupBoard(first, cases[0].boardStr);
+    std::vector<char> firstRack(cases[0].rackStr.begin(), cases[0].rackStr.end());
+    std::vector<std::string> expected = moveKeys(generator.generateMoves(first, firstRack, gaddag));
+
+    for (int prefetch = 0; prefetch < 2; ++prefetch) {
+        auto t0 = std::chrono::high_resolution_clock::now();
+        LazyGaddag lexicon;
+        if (!lexicon.open(lazyPath, prefetch == 1)) return 1;
+        double opened = ms(t0);
+        bool same = moveKeys(generator.generateMoves(first, firstRack, lexicon, context)) == expected;
+        double firstMove = ms(t0);
+        int pages = lexicon.pagesLoaded();
+        lexicon.warmUp();
+        double warm = ms(t0);
+        std::cout << (prefetch ? "Lazy + prefetch: " : "Lazy on demand:  ") << "first move after " << firstMove
+                  << " ms (open " << opened << " ms, " << pages << "/" << lexicon.pageCount()
+                  << " pages), fully warm after " << warm << " ms" << std::endl;
+        if (!same) {
+            std::cerr << "Lazy GADDAG moves differ on the first position" << std::endl;
+            return 1;
+        }
+    }
+    auto t0 = std::chrono::high_resolution_clock::now();
+    Gaddag eager;
+    if (!eager.loadBinary(binPath)) return 1;
+    double loaded = ms(t0);
+    generator.generateMoves(first, firstRack, eager, context);
+    std::cout << "Full load:       first move after " << ms(t0) << " ms (load " << loaded << " ms)" << std::endl;
+
     return 0;
 }
\ No newline at end of file
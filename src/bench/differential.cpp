@@ -0,0 +1,274 @@
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include <string>
+#include <set>
+#include <chrono>
+#include <iomanip>
+#include <cstdlib>
+#include <cctype>
+#include <algorithm>
+
+#include "../engine/Gaddag.h"
+#include "../engine/MoveGenerator.h"
+#include "../engine/Game.h"
+#include "../engine/Rules.h"
+
+#include "game.h"
+#include "datamanager.h"
+#include "lexiconparameters.h"
+#include "alphabetparameters.h"
+#include "board.h"
+#include "move.h"
+
+using namespace std;
+
+// Differential harness: runs our engine and Quackle on the same positions in one
+// process and diffs the move sets. Exits with status 1 if any position differs.
+
+typedef std::chrono::steady_clock Clock;
+
+struct Pos {
+    string board;
+    string rack;
+};
+
+// Helper subclass to access protected Board::m_letters (same as quackle_bench)
+class MyBoard : public Quackle::Board {
+public:
+    using Quackle::Board::Board;
+
+    void setSquare(int r, int c, Quackle::Letter l) {
+        if (r >= 0 && r < height() && c >= 0 && c < width()) {
+            m_letters[r][c] = l;
+            m_empty = false;
+        }
+    }
+};
+
+// Normalised move: placed squares and letters only, so both engines agree on
+// representation. A single tile is keyed without a direction, since it forms
+// a word both ways and each engine picks one.
+static string moveKey(int row, int col, bool horizontal, const string& word, const string& boardStr) {
+    int tiles = 0;
+    string single;
+    for (size_t i = 0; i < word.length(); ++i) {
+        int r = row + (horizontal ? 0 : (int)i);
+        int c = col + (horizontal ? (int)i : 0);
+        if (boardStr[r * 15 + c] != '.') continue;
+        tiles++;
+        single = to_string(r) + " " + to_string(c) + " " + word[i];
+    }
+    if (tiles == 1) return "1 " + single;
+    return string(horizontal ? "H " : "V ") + to_string(row) + " " + to_string(col) + " " + word;
+}
+
+static set<string> ourMoves(const Pos& p, const Scrabble::MoveGenerator& generator, const Scrabble::Gaddag& gaddag,
+                            long long& us) {
+    ::Board board = Scrabble::boardFromString(p.board);
+    vector<char> rack(p.rack.begin(), p.rack.end());
+
+    auto t0 = Clock::now();
+    vector<::Move> moves = Scrabble::generateScoredMoves(board, rack, generator, gaddag);
+    auto t1 = Clock::now();
+    us = std::chrono::duration_cast<std::chrono::microseconds>(t1 - t0).count();
+
+    set<string> keys;
+    for (const ::Move& m : moves) keys.insert(moveKey(m.row, m.col, m.horizontal, m.word, p.board));
+    return keys;
+}
+
+static set<string> quackleMoves(const Pos& p, const Quackle::AlphabetParameters* alpha, long long& us) {
+    Quackle::Game game;
+    Quackle::PlayerList players;
+    players.push_back(Quackle::Player(MARK_UV("P1")));
+    players.push_back(Quackle::Player(MARK_UV("P2")));
+    game.setPlayers(players);
+    game.addPosition();
+    Quackle::GamePosition& pos = game.currentPosition();
+
+    MyBoard board(15, 15);
+    board.prepareEmptyBoard();
+    for (int r = 0; r < 15; ++r) {
+        for (int c = 0; c < 15; ++c) {
+            char ch = p.board[r * 15 + c];
+            if (ch == '.') continue;
+            // Blankness only changes scores, not the move set
+            Quackle::LetterString ls = alpha->encode(string(1, (char)toupper(ch)));
+            if (ls.length() > 0) board.setSquare(r, c, ls[0]);
+        }
+    }
+    pos.setBoard(board);
+    pos.ensureBoardIsPreparedForAnalysis();
+
+    Quackle::LetterString rack;
+    for (char c : p.rack) {
+        if (c == '?' || c == '*') rack += QUACKLE_BLANK_MARK;
+        else rack += alpha->encode(string(1, c));
+    }
+    pos.currentPlayer().setRack(rack);
+
+    // kibitz keeps at most `limit` moves: a full list means some may be missing, so retry
+    // with a larger limit and time only the run that returned every move
+    size_t limit = 50000;
+    for (;;) {
+        auto t0 = Clock::now();
+        pos.kibitz((int)limit);
+        auto t1 = Clock::now();
+        us = std::chrono::duration_cast<std::chrono::microseconds>(t1 - t0).count();
+        if (pos.moves().size() < limit) break;
+        limit *= 4;
+    }
+    const Quackle::MoveList& moves = pos.moves();
+
+    set<string> keys;
+    for (const Quackle::Move& m : moves) {
+        if (m.action != Quackle::Move::Place) continue;
+        // Played-through squares are marked in tiles(); read them from the board
+        const Quackle::LetterString& tiles = m.tiles();
+        string word;
+        for (size_t i = 0; i < tiles.length(); ++i) {
+            int r = m.startrow + (m.horizontal ? 0 : (int)i);
+            int c = m.startcol + (m.horizontal ? (int)i : 0);
+            if (tiles[i] == QUACKLE_PLAYED_THRU_MARK) {
+                word += (char)toupper(p.board[r * 15 + c]);
+            } else {
+                string letter = alpha->userVisible(alpha->clearBlankness(tiles[i]));
+                for (char ch : letter) word += (char)toupper(ch);
+            }
+        }
+        keys.insert(moveKey(m.startrow, m.startcol, m.horizontal, word, p.board));
+    }
+    return keys;
+}
+
+void printUsage(const char* prog) {
+    cerr << "Usage: " << prog << " [options]\n"
+         << "  --positions PATH  Positions file (default assets/benchmarks/synthetic_positions.txt)\n"
+         << "  --limit N         Only the first N positions\n"
+         << "  --show N          List up to N missing/extra moves per differing position (default 5)\n"
+         << "  --csv PATH        Per-position report (counts, missing, extra, times, speed ratio)\n"
+         << "  --dict PATH       Word list (default assets/dictionnaries/french.txt)\n"
+         << "  --bin PATH        Binary GADDAG cache (default assets/dictionnaries/french.bin)\n"
+         << "  --gaddag PATH     Quackle GADDAG (default assets/dictionnaries/french.gaddag)\n";
+}
+
+int main(int argc, char** argv) {
+    string positionsPath = "assets/benchmarks/synthetic_positions.txt";
+    string dictPath = "assets/dictionnaries/french.txt";
+    string binPath = "assets/dictionnaries/french.bin";
+    string quackleGaddagPath = "assets/dictionnaries/french.gaddag";
+    string csvPath;
+    size_t limit = 0;
+    size_t show = 5;
+
+    for (int i = 1; i < argc; ++i) {
+        string arg = argv[i];
+        if (i + 1 >= argc) {
+            printUsage(argv[0]);
+            return 2;
+        }
+        string value = argv[++i];
+        if (arg == "--positions") positionsPath = value;
+        else if (arg == "--limit") limit = (size_t)atol(value.c_str());
+        else if (arg == "--show") show = (size_t)atol(value.c_str());
+        else if (arg == "--csv") csvPath = value;
+        else if (arg == "--dict") dictPath = value;
+        else if (arg == "--bin") binPath = value;
+        else if (arg == "--gaddag") quackleGaddagPath = value;
+        else {
+            printUsage(argv[0]);
+            return 2;
+        }
+    }
+
+    cout << "=== Differential Harness (Engine vs Quackle) ===" << endl;
+
+    Scrabble::Gaddag gaddag;
+    if (!gaddag.loadCached(dictPath, binPath)) {
+        cerr << "Failed to load dictionary: " << dictPath << endl;
+        return 2;
+    }
+    Quackle::DataManager dm;
+    Quackle::AlphabetParameters* alpha = dm.alphabetParameters();
+    dm.lexiconParameters()->loadGaddag(quackleGaddagPath);
+    if (!dm.lexiconParameters()->hasGaddag()) {
+        cerr << "Failed to load Quackle GADDAG: " << quackleGaddagPath << endl;
+        return 2;
+    }
+
+    vector<Pos> positions;
+    ifstream posFile(positionsPath);
+    string line;
+    while (getline(posFile, line)) {
+        size_t pipe = line.find('|');
+        if (pipe == string::npos) continue;
+        Pos p;
+        p.board = line.substr(0, pipe);
+        p.board.erase(remove_if(p.board.begin(), p.board.end(), ::isspace), p.board.end());
+        p.rack = line.substr(pipe + 1);
+        p.rack.erase(remove_if(p.rack.begin(), p.rack.end(), ::isspace), p.rack.end());
+        if (p.board.length() != 225) continue;
+        positions.push_back(p);
+        if (limit && positions.size() >= limit) break;
+    }
+    if (positions.empty()) {
+        cerr << "No positions in " << positionsPath << endl;
+        return 2;
+    }
+    cout << "Comparing " << positions.size() << " positions." << endl;
+
+    ofstream csv;
+    if (!csvPath.empty()) {
+        csv.open(csvPath);
+        csv << "position,rack,ours,quackle,missing,extra,ours_us,quackle_us,speed_ratio\n";
+    }
+
+    Scrabble::MoveGenerator generator;
+    size_t differing = 0, totalMissing = 0, totalExtra = 0, totalOurs = 0, totalQuackle = 0;
+    long long totalOurUs = 0, totalQuackleUs = 0;
+
+    for (size_t i = 0; i < positions.size(); ++i) {
+        long long ourUs = 0, quackleUs = 0;
+        set<string> ours = ourMoves(positions[i], generator, gaddag, ourUs);
+        set<string> theirs = quackleMoves(positions[i], alpha, quackleUs);
+
+        vector<string> missing, extra;
+        set_difference(theirs.begin(), theirs.end(), ours.begin(), ours.end(), back_inserter(missing));
+        set_difference(ours.begin(), ours.end(), theirs.begin(), theirs.end(), back_inserter(extra));
+
+        totalOurs += ours.size();
+        totalQuackle += theirs.size();
+        totalMissing += missing.size();
+        totalExtra += extra.size();
+        totalOurUs += ourUs;
+        totalQuackleUs += quackleUs;
+        // > 1 means we are slower than Quackle (see the note printed with the totals)
+        double ratio = quackleUs > 0 ? (double)ourUs / quackleUs : 0;
+
+        if (csv.is_open()) {
+            csv << i << ',' << positions[i].rack << ',' << ours.size() << ',' << theirs.size() << ','
+                << missing.size() << ',' << extra.size() << ',' << ourUs << ',' << quackleUs << ','
+                << ratio << '\n';
+        }
+
+        if (missing.empty() && extra.empty()) continue;
+        differing++;
+        cout << "#" << i << " rack " << positions[i].rack << ": ours " << ours.size() << ", quackle "
+             << theirs.size() << ", missing " << missing.size() << ", extra " << extra.size()
+             << ", speed ratio " << fixed << setprecision(2) << ratio << endl;
+        for (size_t k = 0; k < missing.size() && k < show; ++k) cout << "  - " << missing[k] << endl;
+        for (size_t k = 0; k < extra.size() && k < show; ++k) cout << "  + " << extra[k] << endl;
+    }
+
+    cout << string(40, '-') << endl;
+    cout << "Positions differing: " << differing << " / " << positions.size() << endl;
+    cout << "Moves: ours " << totalOurs << ", quackle " << totalQuackle
+         << " (missing " << totalMissing << ", extra " << totalExtra << ")" << endl;
+    cout << "Time: ours " << totalOurUs << " us, quackle " << totalQuackleUs << " us, ratio "
+         << fixed << setprecision(2) << (totalQuackleUs > 0 ? (double)totalOurUs / totalQuackleUs : 0) << endl;
+    cout << "  ours: generateScoredMoves (generation, dedup, scoring, sort)" << endl;
+    cout << "  quackle: kibitz (generation, scoring, leave equity, sort), so the ratio favours us a little" << endl;
+
+    return differing == 0 ? 0 : 1;
+}
@@ -0,0 +1,618 @@
+#include "../engine/engine.h"
+#include "../engine/Gaddag.h"
+#include "../engine/MoveGenerator.h"
+#include "../engine/Game.h"
+#include "../engine/Rules.h"
+#include "../engine/Instrumentation.h"
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include <string>
+#include <map>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <algorithm>
+#include <sstream>
+#include <cmath>
+
+using namespace Scrabble;
+
+// Stage-level microbenchmark: times every step of move generation separately,
+// after warmup runs, and reports percentiles per stage and per position class.
+
+typedef std::chrono::steady_clock Clock;
+
+struct BenchmarkCase {
+    Board board;
+    std::vector<char> rack;
+    std::string positionClass;
+};
+
+struct StageRow {
+    std::string stage;
+    std::string positionClass;
+    size_t samples;
+    double mean, p50, p90, p99, max;
+};
+
+static double microseconds(Clock::time_point a, Clock::time_point b) {
+    return std::chrono::duration<double, std::micro>(b - a).count();
+}
+
+// Bucket positions by board fill; racks holding a blank get their own classes
+static std::string classify(const Board& board, const std::vector<char>& rack) {
+    int tiles = 0;
+    for (int r = 0; r < 15; ++r) {
+        for (int c = 0; c < 15; ++c) {
+            if (!board.isEmpty(r, c)) tiles++;
+        }
+    }
+    std::string name = tiles == 0 ? "empty" : tiles <= 20 ? "opening" : tiles <= 60 ? "midgame" : "endgame";
+    bool blank = std::any_of(rack.begin(), rack.end(), isBlankTile);
+    return blank ? name + "+blank" : name;
+}
+
+static std::vector<BenchmarkCase> loadBenchmarks(const std::string& path) {
+    std::vector<BenchmarkCase> cases;
+    std::ifstream file(path);
+    if (!file.is_open()) {
+        std::cerr << "Error: Could not open benchmark file " << path << std::endl;
+        return cases;
+    }
+
+    std::string line;
+    while (std::getline(file, line)) {
+        size_t delimiterPos = line.find('|');
+        if (delimiterPos == std::string::npos) continue;
+        std::string boardStr = line.substr(0, delimiterPos);
+        std::string rackStr = line.substr(delimiterPos + 1);
+        boardStr.erase(boardStr.find_last_not_of(" \n\r\t") + 1);
+        rackStr.erase(0, rackStr.find_first_not_of(" \n\r\t"));
+        rackStr.erase(rackStr.find_last_not_of(" \n\r\t") + 1);
+
+        BenchmarkCase bc;
+        bc.board = boardFromString(boardStr);
+        bc.rack.assign(rackStr.begin(), rackStr.end());
+        bc.positionClass = classify(bc.board, bc.rack);
+        cases.push_back(bc);
+    }
+    return cases;
+}
+
+// Nearest-rank percentile of sorted samples
+static double percentile(const std::vector<double>& sorted, double p) {
+    if (sorted.empty()) return 0;
+    size_t rank = (size_t)(p / 100.0 * sorted.size() + 0.999999);
+    if (rank == 0) rank = 1;
+    return sorted[std::min(rank, sorted.size()) - 1];
+}
+
+static StageRow summarise(const std::string& stage, const std::string& positionClass, std::vector<double> samples) {
+    std::sort(samples.begin(), samples.end());
+    StageRow row;
+    row.stage = stage;
+    row.positionClass = positionClass;
+    row.samples = samples.size();
+    double sum = 0;
+    for (double s : samples) sum += s;
+    row.mean = samples.empty() ? 0 : sum / samples.size();
+    row.p50 = percentile(samples, 50);
+    row.p90 = percentile(samples, 90);
+    row.p99 = percentile(samples, 99);
+    row.max = samples.empty() ? 0 : samples.back();
+    return row;
+}
+
+// Samples per stage, then per position class
+typedef std::map<std::string, std::map<std::string, std::vector<double>>> SampleTable;
+
+// Per-position stages, in pipeline order
+static const int STAGE_COUNT = 7;
+static const char* STAGES[STAGE_COUNT] = {"cross_checks", "anchors", "traverse", "record", "dedup", "score", "total"};
+
+struct PositionResult {
+    std::string positionClass;
+    size_t moves = 0;
+    std::vector<double> samples[STAGE_COUNT];
+    GenCounters counters;  // One end-to-end generation (zero unless instrumented)
+};
+
+// One timed pass over a position. Stages cover both directions, as generateScoredMoves does.
+static void timePosition(const BenchmarkCase& bc, const MoveGenerator& generator, const Gaddag& gaddag,
+                         PositionResult* result) {
+    double crossChecks = 0, anchors = 0, traverse = 0, record = 0;
+    std::vector<Move> all;
+    Board boards[2] = {bc.board, bc.board.transposed()};
+
+    for (int dir = 0; dir < 2; ++dir) {
+        const Board& board = boards[dir];
+        uint32_t checks[15][15];
+        int anchorList[225];
+        std::vector<Move> moves;
+        std::vector<Move> replay;
+
+        auto t0 = Clock::now();
+        generator.computeCrossChecks(board, gaddag, checks);
+        auto t1 = Clock::now();
+        int anchorCount = generator.findAnchors(board, anchorList);
+        auto t2 = Clock::now();
+        generator.generateFromAnchors(board, bc.rack, gaddag, checks, anchorList, anchorCount, moves);
+        auto t3 = Clock::now();
+
+        // Recording happens inside the traversal; replay it alone, through the same code, to isolate its cost
+        char lines[15][15];
+        for (int r = 0; r < 15; ++r) {
+            for (int c = 0; c < 15; ++c) lines[r][c] = board.isEmpty(r, c) ? 0 : board.getTile(r, c).letter;
+        }
+        replay.reserve(moves.size());
+        auto t4 = Clock::now();
+        for (const Move& m : moves) {
+            generator.recordMove(m.row, lines[m.row], m.word.data(), m.col + (int)m.word.length(),
+                                 (int)m.word.length(), replay);
+        }
+        auto t5 = Clock::now();
+
+        crossChecks += microseconds(t0, t1);
+        anchors += microseconds(t1, t2);
+        traverse += microseconds(t2, t3);
+        record += microseconds(t4, t5);
+
+        for (Move& m : moves) {
+            if (dir == 1) {
+                std::swap(m.row, m.col);
+                m.horizontal = false;
+            }
+            all.push_back(m);
+        }
+    }
+
+    auto t0 = Clock::now();
+    std::sort(all.begin(), all.end(), [](const Move& a, const Move& b) {
+        if (a.row != b.row) return a.row < b.row;
+        if (a.col != b.col) return a.col < b.col;
+        if (a.horizontal != b.horizontal) return a.horizontal < b.horizontal;
+        return a.word < b.word;
+    });
+    auto last = std::unique(all.begin(), all.end(), [](const Move& a, const Move& b) {
+        return a.row == b.row && a.col == b.col && a.horizontal == b.horizontal && a.word == b.word;
+    });
+    all.erase(last, all.end());
+    auto t1 = Clock::now();
+    for (Move& m : all) {
+        resolveAndScore(bc.board, m, bc.rack);
+    }
+    auto t2 = Clock::now();
+
+    // End to end, as callers see it
+    GenCounters before = threadCounters();
+    auto t3 = Clock::now();
+    std::vector<Move> full = generateScoredMoves(bc.board, bc.rack, generator, gaddag);
+    auto t4 = Clock::now();
+    GenCounters after = threadCounters();
+
+    if (!result) return;
+    double values[STAGE_COUNT] = {crossChecks, anchors, traverse, record, microseconds(t0, t1),
+                                  microseconds(t1, t2), microseconds(t3, t4)};
+    for (int i = 0; i < STAGE_COUNT; ++i) result->samples[i].push_back(values[i]);
+    result->positionClass = bc.positionClass;
+    result->moves = full.size();
+    result->counters = after;
+    result->counters.nodesVisited -= before.nodesVisited;
+    result->counters.arcsTried -= before.arcsTried;
+    result->counters.crossCheckRejects -= before.crossCheckRejects;
+    result->counters.rackAttempts -= before.rackAttempts;
+    result->counters.blankExpansions -= before.blankExpansions;
+    result->counters.delimiterTransitions -= before.delimiterTransitions;
+    result->counters.movesRecorded -= before.movesRecorded;
+    result->counters.duplicates -= before.duplicates;
+}
+
+/*
+ * Baseline files: CSV, one row per position, holding the median time of each
+ * stage over the timed passes, the move count and the generator counters
+ * (zero unless built with SCRABBLE_INSTRUMENT). Columns are matched by name.
+ */
+
+static const int COUNTER_COUNT = 8;
+static const char* COUNTERS[COUNTER_COUNT] = {"nodes_visited", "arcs_tried", "cross_check_rejects", "rack_attempts",
+                                              "blank_expansions", "delimiter_transitions", "moves_recorded",
+                                              "duplicates"};
+
+static void counterValues(const GenCounters& c, uint64_t out[COUNTER_COUNT]) {
+    uint64_t values[COUNTER_COUNT] = {c.nodesVisited, c.arcsTried, c.crossCheckRejects, c.rackAttempts,
+                                      c.blankExpansions, c.delimiterTransitions, c.movesRecorded, c.duplicates};
+    std::copy(values, values + COUNTER_COUNT, out);
+}
+
+static double median(std::vector<double> v) {
+    if (v.empty()) return 0;
+    std::sort(v.begin(), v.end());
+    size_t n = v.size();
+    return n % 2 ? v[n / 2] : (v[n / 2 - 1] + v[n / 2]) / 2;
+}
+
+static bool writeBaseline(const std::string& path, const std::vector<PositionResult>& results,
+                          const std::string& positionsPath, int reps) {
+    std::ofstream out(path);
+    if (!out.is_open()) {
+        std::cerr << "Error opening baseline file for writing: " << path << std::endl;
+        return false;
+    }
+    out << "# microbench baseline v1, positions=" << positionsPath << ", reps=" << reps
+        << ", instrumented=" << (INSTRUMENTATION_ENABLED ? 1 : 0) << "\n";
+    out << "position,class,moves";
+    for (const char* stage : STAGES) out << ',' << stage << "_us";
+    for (const char* counter : COUNTERS) out << ',' << counter;
+    out << '\n';
+    for (size_t i = 0; i < results.size(); ++i) {
+        const PositionResult& r = results[i];
+        out << i << ',' << r.positionClass << ',' << r.moves;
+        for (int s = 0; s < STAGE_COUNT; ++s) out << ',' << median(r.samples[s]);
+        uint64_t counters[COUNTER_COUNT];
+        counterValues(r.counters, counters);
+        for (uint64_t c : counters) out << ',' << c;
+        out << '\n';
+    }
+    return out.good();
+}
+
+struct BaselineRow {
+    std::string positionClass;
+    size_t moves = 0;
+    double stages[STAGE_COUNT] = {};
+    double counters[COUNTER_COUNT] = {};
+};
+
+static bool readBaseline(const std::string& path, std::map<size_t, BaselineRow>& rows) {
+    std::ifstream in(path);
+    if (!in.is_open()) {
+        std::cerr << "Error opening baseline file: " << path << std::endl;
+        return false;
+    }
+    std::string line;
+    std::vector<std::string> header;
+    while (std::getline(in, line)) {
+        if (line.empty() || line[0] == '#') continue;
+        std::vector<std::string> fields;
+        std::stringstream ss(line);
+        std::string field;
+        while (std::getline(ss, field, ',')) fields.push_back(field);
+        if (header.empty()) {
+            header = fields;
+            continue;
+        }
+        if (fields.size() != header.size()) {
+            std::cerr << "Malformed baseline row in " << path << ": " << line << std::endl;
+            return false;
+        }
+        BaselineRow row;
+        size_t position = 0;
+        for (size_t f = 0; f < header.size(); ++f) {
+            const std::string& name = header[f];
+            if (name == "position") position = (size_t)std::atol(fields[f].c_str());
+            else if (name == "class") row.positionClass = fields[f];
+            else if (name == "moves") row.moves = (size_t)std::atol(fields[f].c_str());
+            for (int s = 0; s < STAGE_COUNT; ++s) {
+                if (name == std::string(STAGES[s]) + "_us") row.stages[s] = std::atof(fields[f].c_str());
+            }
+            for (int c = 0; c < COUNTER_COUNT; ++c) {
+                if (name == COUNTERS[c]) row.counters[c] = std::atof(fields[f].c_str());
+            }
+        }
+        rows[position] = row;
+    }
+    if (rows.empty()) {
+        std::cerr << "Empty baseline: " << path << std::endl;
+        return false;
+    }
+    return true;
+}
+
+// One-sided Wilcoxon signed-rank test (normal approximation) on paired log ratios.
+// Returns the p-value for "new is slower than old".
+static double wilcoxonSlower(const std::vector<double>& logRatios) {
+    std::vector<double> d;
+    for (double x : logRatios) {
+        if (x != 0) d.push_back(x);
+    }
+    size_t n = d.size();
+    if (n == 0) return 1.0;
+    std::vector<size_t> order(n);
+    for (size_t i = 0; i < n; ++i) order[i] = i;
+    std::sort(order.begin(), order.end(), [&](size_t a, size_t b) { return std::fabs(d[a]) < std::fabs(d[b]); });
+
+    // Average ranks over ties
+    double positive = 0;
+    for (size_t i = 0; i < n;) {
+        size_t j = i;
+        while (j + 1 < n && std::fabs(d[order[j + 1]]) == std::fabs(d[order[i]])) j++;
+        double rank = (i + j + 2) / 2.0;
+        for (size_t k = i; k <= j; ++k) {
+            if (d[order[k]] > 0) positive += rank;
+        }
+        i = j + 1;
+    }
+    double mean = n * (n + 1) / 4.0;
+    double sd = std::sqrt(n * (n + 1) * (2 * n + 1) / 24.0);
+    double z = (positive - mean) / sd;
+    return 0.5 * std::erfc(z / std::sqrt(2.0));
+}
+
+// Compare two baselines per stage and per class; returns the number of regressions
+static int compareBaselines(const std::string& oldPath, const std::string& newPath, double thresholdPct, double alpha) {
+    std::map<size_t, BaselineRow> before, after;
+    if (!readBaseline(oldPath, before) || !readBaseline(newPath, after)) return -1;
+
+    // Pair positions present in both runs with the same class
+    std::map<std::string, std::vector<std::pair<const BaselineRow*, const BaselineRow*>>> pairs;
+    size_t movesChanged = 0;
+    for (const auto& entry : before) {
+        auto it = after.find(entry.first);
+        if (it == after.end() || it->second.positionClass != entry.second.positionClass) continue;
+        pairs[entry.second.positionClass].push_back(std::make_pair(&entry.second, &it->second));
+        pairs["all"].push_back(std::make_pair(&entry.second, &it->second));
+        if (it->second.moves != entry.second.moves) movesChanged++;
+    }
+    if (pairs.empty()) {
+        std::cerr << "The baselines have no positions in common." << std::endl;
+        return -1;
+    }
+
+    double limit = 1.0 + thresholdPct / 100.0;
+    int regressions = 0;
+    std::cout << "Threshold " << thresholdPct << "%, significance " << alpha
+              << ". Ratios are new/old (geometric mean over positions).\n";
+    std::cout << std::left << std::setw(22) << "Metric" << std::setw(16) << "Class" << std::right
+              << std::setw(7) << "N" << std::setw(10) << "Ratio" << std::setw(12) << "p" << "  Verdict" << std::endl;
+    std::cout << std::string(76, '-') << std::endl;
+
+    auto report = [&](const std::string& metric, const std::string& cls, size_t n, double ratio, double p,
+                      bool regression) {
+        std::cout << std::left << std::setw(22) << metric << std::setw(16) << cls << std::right << std::setw(7) << n
+                  << std::setw(10) << std::fixed << std::setprecision(3) << ratio << std::setw(12);
+        if (p < 0) std::cout << "-";
+        else std::cout << std::setprecision(4) << p;
+        // p is one-sided towards "slower"; a significant speedup has p near 1
+        bool faster = ratio < 1.0 / limit && (p < 0 || 1.0 - p < alpha);
+        std::cout << "  " << (regression ? "REGRESSION" : faster ? "faster" : "ok") << std::endl;
+        if (regression) regressions++;
+    };
+
+    // Timings: noisy, so a regression must be both large and significant
+    for (int s = 0; s < STAGE_COUNT; ++s) {
+        for (const auto& cls : pairs) {
+            std::vector<double> logRatios;
+            for (const auto& pr : cls.second) {
+                if (pr.first->stages[s] > 0 && pr.second->stages[s] > 0) {
+                    logRatios.push_back(std::log(pr.second->stages[s] / pr.first->stages[s]));
+                }
+            }
+            if (logRatios.empty()) continue;
+            double mean = 0;
+            for (double x : logRatios) mean += x;
+            double ratio = std::exp(mean / logRatios.size());
+            double p = wilcoxonSlower(logRatios);
+            report(STAGES[s], cls.first, logRatios.size(), ratio, p, ratio > limit && p < alpha);
+        }
+    }
+
+    // Counters: deterministic, so any increase past the threshold counts
+    for (int c = 0; c < COUNTER_COUNT; ++c) {
+        for (const auto& cls : pairs) {
+            double oldSum = 0, newSum = 0;
+            for (const auto& pr : cls.second) {
+                oldSum += pr.first->counters[c];
+                newSum += pr.second->counters[c];
+            }
+            if (oldSum == 0 || newSum == 0) continue;
+            double ratio = newSum / oldSum;
+            report(COUNTERS[c], cls.first, cls.second.size(), ratio, -1, ratio > limit);
+        }
+    }
+
+    if (movesChanged > 0) {
+        std::cout << "\nWarning: move counts differ on " << movesChanged
+                  << " positions (different positions or a generator change)." << std::endl;
+    }
+    std::cout << "\n" << regressions << " regression(s)." << std::endl;
+    return regressions;
+}
+
+// Silence the dictionary's progress messages while it is being timed
+struct QuietCout {
+    std::streambuf* saved;
+    QuietCout() : saved(std::cout.rdbuf(nullptr)) {}
+    ~QuietCout() {
+        std::cout.rdbuf(saved);
+        std::cout.clear();
+    }
+};
+
+static void writeCsv(const std::string& path, const std::vector<StageRow>& rows) {
+    std::ofstream out(path);
+    out << "stage,class,samples,mean_us,p50_us,p90_us,p99_us,max_us\n";
+    for (const StageRow& r : rows) {
+        out << r.stage << ',' << r.positionClass << ',' << r.samples << ',' << r.mean << ','
+            << r.p50 << ',' << r.p90 << ',' << r.p99 << ',' << r.max << '\n';
+    }
+}
+
+static void writeJson(const std::string& path, const std::vector<StageRow>& rows,
+                      size_t positions, int warmup, int reps) {
+    std::ofstream out(path);
+    out << "{\n  \"positions\": " << positions << ",\n  \"warmup\": " << warmup
+        << ",\n  \"reps\": " << reps << ",\n  \"unit\": \"us\",\n  \"results\": [\n";
+    for (size_t i = 0; i < rows.size(); ++i) {
+        const StageRow& r = rows[i];
+        out << "    {\"stage\": \"" << r.stage << "\", \"class\": \"" << r.positionClass
+            << "\", \"samples\": " << r.samples << ", \"mean\": " << r.mean << ", \"p50\": " << r.p50
+            << ", \"p90\": " << r.p90 << ", \"p99\": " << r.p99 << ", \"max\": " << r.max << "}"
+            << (i + 1 < rows.size() ? "," : "") << "\n";
+    }
+    out << "  ]\n}\n";
+}
+
+void printUsage(const char* prog) {
+    std::cerr << "Usage: " << prog << " [options]\n"
+              << "  --positions PATH Benchmark positions (default assets/benchmarks/synthetic_positions.txt)\n"
+              << "  --warmup N       Untimed passes over all positions (default 2)\n"
+              << "  --reps N         Timed passes over all positions (default 10)\n"
+              << "  --load-reps N    Timed dictionary loads, text and binary (default 1)\n"
+              << "  --csv PATH       Write results as CSV\n"
+              << "  --json PATH      Write results as JSON\n"
+              << "  --baseline PATH  Write per-position medians, move counts and counters as a baseline\n"
+              << "  --compare OLD NEW  Compare two baselines instead of running (exit 1 on regression)\n"
+              << "  --threshold PCT  Slowdown that counts as a regression in --compare (default 5)\n"
+              << "  --alpha P        Significance level for --compare (default 0.01)\n"
+              << "  --dict PATH      Word list (default assets/dictionnaries/french.txt)\n"
+              << "  --bin PATH       Binary GADDAG cache (default assets/dictionnaries/french.bin)\n";
+}
+
+int main(int argc, char** argv) {
+    std::string positionsPath = "assets/benchmarks/synthetic_positions.txt";
+    std::string dictPath = "assets/dictionnaries/french.txt";
+    std::string binPath = "assets/dictionnaries/french.bin";
+    std::string csvPath, jsonPath, baselinePath;
+    std::string compareOld, compareNew;
+    double thresholdPct = 5.0;
+    double alpha = 0.01;
+    int warmup = 2;
+    int reps = 10;
+    int loadReps = 1;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (i + 1 >= argc) {
+            printUsage(argv[0]);
+            return 1;
+        }
+        std::string value = argv[++i];
+        if (arg == "--compare") {
+            if (i + 1 >= argc) {
+                printUsage(argv[0]);
+                return 1;
+            }
+            compareOld = value;
+            compareNew = argv[++i];
+        }
+        else if (arg == "--positions") positionsPath = value;
+        else if (arg == "--warmup") warmup = std::atoi(value.c_str());
+        else if (arg == "--reps") reps = std::atoi(value.c_str());
+        else if (arg == "--load-reps") loadReps = std::atoi(value.c_str());
+        else if (arg == "--csv") csvPath = value;
+        else if (arg == "--json") jsonPath = value;
+        else if (arg == "--baseline") baselinePath = value;
+        else if (arg == "--threshold") thresholdPct = std::atof(value.c_str());
+        else if (arg == "--alpha") alpha = std::atof(value.c_str());
+        else if (arg == "--dict") dictPath = value;
+        else if (arg == "--bin") binPath = value;
+        else {
+            printUsage(argv[0]);
+            return 1;
+        }
+    }
+    if (reps < 1) reps = 1;
+
+    if (!compareOld.empty()) {
+        std::cout << "=== Baseline Comparison ===" << std::endl;
+        int regressions = compareBaselines(compareOld, compareNew, thresholdPct, alpha);
+        return regressions == 0 ? 0 : 1;
+    }
+
+    std::cout << "=== Scrabble Stage Microbenchmark ===" << std::endl;
+
+    // 1. Dictionary load, text then binary
+    SampleTable samples;
+    Gaddag gaddag;
+    // Like loadCached, the binary is only written when missing, so --bin is never overwritten
+    bool haveBinary = std::ifstream(binPath).good();
+    for (int i = 0; i < std::max(1, loadReps); ++i) {
+        Gaddag fresh;
+        QuietCout quiet;
+        auto t0 = Clock::now();
+        bool ok = fresh.loadFromFile(dictPath);
+        auto t1 = Clock::now();
+        if (!ok) {
+            std::cerr << "Failed to load dictionary: " << dictPath << std::endl;
+            return 1;
+        }
+        if (i < loadReps) samples["load_text"]["all"].push_back(microseconds(t0, t1));
+        if (i == 0 && !haveBinary && !fresh.saveBinary(binPath)) return 1;
+    }
+    for (int i = 0; i < std::max(1, loadReps); ++i) {
+        QuietCout quiet;
+        Gaddag fresh;
+        auto t0 = Clock::now();
+        bool ok = fresh.loadBinary(binPath);
+        auto t1 = Clock::now();
+        if (!ok) {
+            std::cerr << "Failed to load binary dictionary: " << binPath << std::endl;
+            return 1;
+        }
+        if (i < loadReps) samples["load_binary"]["all"].push_back(microseconds(t0, t1));
+    }
+    {
+        QuietCout quiet;
+        gaddag.loadBinary(binPath);
+    }
+
+    // 2. Positions
+    std::vector<BenchmarkCase> cases = loadBenchmarks(positionsPath);
+    if (cases.empty()) return 1;
+    std::cout << "Loaded " << cases.size() << " positions; " << warmup << " warmup and "
+              << reps << " timed passes." << std::endl;
+
+    MoveGenerator generator;
+    for (int w = 0; w < warmup; ++w) {
+        for (const BenchmarkCase& bc : cases) timePosition(bc, generator, gaddag, nullptr);
+    }
+    resetCounters();
+    std::vector<PositionResult> results(cases.size());
+    for (int r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < cases.size(); ++i) timePosition(cases[i], generator, gaddag, &results[i]);
+    }
+    for (const PositionResult& result : results) {
+        for (int s = 0; s < STAGE_COUNT; ++s) {
+            std::vector<double>& byClass = samples[STAGES[s]][result.positionClass];
+            std::vector<double>& all = samples[STAGES[s]]["all"];
+            byClass.insert(byClass.end(), result.samples[s].begin(), result.samples[s].end());
+            all.insert(all.end(), result.samples[s].begin(), result.samples[s].end());
+        }
+    }
+
+    // 3. Report, in pipeline order
+    const char* order[] = {"load_text", "load_binary", "cross_checks", "anchors", "traverse", "record",
+                           "dedup", "score", "total"};
+    std::vector<StageRow> rows;
+    for (const char* stage : order) {
+        auto it = samples.find(stage);
+        if (it == samples.end()) continue;
+        for (const auto& cls : it->second) rows.push_back(summarise(stage, cls.first, cls.second));
+    }
+
+    std::cout << "\nAll times in microseconds. 'traverse' includes recording; 'record' replays it alone.\n";
+    std::cout << std::left << std::setw(14) << "Stage" << std::setw(16) << "Class" << std::right
+              << std::setw(8) << "N" << std::setw(12) << "p50" << std::setw(12) << "p90"
+              << std::setw(12) << "p99" << std::setw(12) << "max" << std::endl;
+    std::cout << std::string(86, '-') << std::endl;
+    std::cout << std::fixed << std::setprecision(1);
+    for (const StageRow& r : rows) {
+        std::cout << std::left << std::setw(14) << r.stage << std::setw(16) << r.positionClass << std::right
+                  << std::setw(8) << r.samples << std::setw(12) << r.p50 << std::setw(12) << r.p90
+                  << std::setw(12) << r.p99 << std::setw(12) << r.max << std::endl;
+    }
+
+    if (INSTRUMENTATION_ENABLED) {
+        std::cout << "\nGenerator counters over the timed passes:" << std::endl;
+        printCounters(std::cout, collectCounters());
+    }
+
+    if (!csvPath.empty()) writeCsv(csvPath, rows);
+    if (!jsonPath.empty()) writeJson(jsonPath, rows, cases.size(), warmup, reps);
+    if (!baselinePath.empty()) {
+        if (!writeBaseline(baselinePath, results, positionsPath, reps)) return 1;
+        std::cout << "Baseline written to " << baselinePath << std::endl;
+    }
+    return 0;
+}
@@ -0,0 +1,321 @@
+#include "scrabble_c.h"
+#include "../engine/Gaddag.h"
+#include "../engine/MoveGenerator.h"
+#include "../engine/Game.h"
+#include "../engine/Rules.h"
+#include "../engine/Encoder.h"
+#include <cstring>
+#include <memory>
+#include <new>
+#include <string>
+#include <vector>
+
+using namespace Scrabble;
+
+static_assert(sizeof(sc_move) == 28, "sc_move layout is part of the ABI");
+
+struct sc_lexicon {
+    Gaddag gaddag;
+};
+
+struct sc_position {
+    Board board;
+    std::vector<char> rack;
+};
+
+struct sc_generator {
+    const sc_lexicon* lexicon;
+    MoveGenerator generator;
+    BoardEncoder encoder;
+
+    explicit sc_generator(const sc_lexicon* lex)
+        : lexicon(lex), encoder(lex->gaddag, generator) {}
+};
+
+static thread_local std::string lastError;
+
+static sc_status fail(sc_status status, const char* message) {
+    lastError = message;
+    return status;
+}
+
+// Run a body that may throw (allocation failures) without letting exceptions cross the ABI
+template <typename F>
+static sc_status guarded(F body) {
+    try {
+        lastError.clear();
+        return body();
+    } catch (const std::bad_alloc&) {
+        return fail(SC_ERR_INTERNAL, "out of memory");
+    } catch (...) {
+        return fail(SC_ERR_INTERNAL, "internal error");
+    }
+}
+
+static bool parseRack(const char* rack, size_t maxLen, std::vector<char>& out) {
+    out.clear();
+    for (size_t i = 0; i < maxLen && rack[i] != '\0'; ++i) {
+        char c = rack[i];
+        if (c >= 'a' && c <= 'z') c = (char)(c - 'a' + 'A');
+        if (!(c >= 'A' && c <= 'Z') && !isBlankTile(c)) return false;
+        out.push_back(c);
+    }
+    return out.size() <= (size_t)RACK_SIZE;
+}
+
+static void toCMove(const Board& board, const Move& m, sc_move& out) {
+    std::memset(&out, 0, sizeof(out));
+    out.row = (int8_t)m.row;
+    out.col = (int8_t)m.col;
+    out.horizontal = m.horizontal ? 1 : 0;
+    out.tile_count = (uint8_t)m.tileCount;
+    out.score = m.score;
+    std::strncpy(out.word, m.word.c_str(), SC_MAX_WORD - 1);
+
+    int placed = 0;
+    for (size_t i = 0; i < m.word.length() && placed < m.tileCount; ++i) {
+        int r = m.row + (m.horizontal ? 0 : (int)i);
+        int c = m.col + (m.horizontal ? (int)i : 0);
+        if (!board.isEmpty(r, c)) continue;
+        if (m.tiles[placed++].isBlank()) out.blank_mask |= (uint16_t)(1u << i);
+    }
+}
+
+static bool fromCMove(const Board& board, const sc_move& in, Move& out) {
+    out = Move();
+    out.row = in.row;
+    out.col = in.col;
+    out.horizontal = in.horizontal != 0;
+    out.word.assign(in.word, strnlen(in.word, SC_MAX_WORD));
+
+    for (size_t i = 0; i < out.word.length(); ++i) {
+        int r = out.row + (out.horizontal ? 0 : (int)i);
+        int c = out.col + (out.horizontal ? (int)i : 0);
+        if (r < 0 || r >= 15 || c < 0 || c >= 15) return false;
+        if (!board.isEmpty(r, c)) continue;
+        if (out.tileCount >= RACK_SIZE) return false;
+        char letter = out.word[i];
+        bool blank = (in.blank_mask >> i) & 1u;
+        out.tiles[out.tileCount++] = Tile(letter, blank ? 0 : letterValue(letter));
+    }
+    return out.tileCount > 0;
+}
+
+// Generate into out starting at `written`; returns the number of moves found
+static size_t generateInto(sc_generator* gen, const Board& board, const std::vector<char>& rack,
+                           sc_move* out, size_t capacity, size_t written, bool& overflow) {
+    std::vector<Move> moves = generateScoredMoves(board, rack, gen->generator, gen->lexicon->gaddag);
+    if (overflow || written + moves.size() > capacity) {
+        overflow = true;
+        return moves.size();
+    }
+    for (size_t i = 0; i < moves.size(); ++i) toCMove(board, moves[i], out[written + i]);
+    return moves.size();
+}
+
+extern "C" {
+
+uint32_t sc_abi_version(void) {
+    return SC_ABI_VERSION;
+}
+
+const char* sc_last_error(void) {
+    return lastError.c_str();
+}
+
+sc_lexicon* sc_lexicon_load(const char* text_path, const char* binary_path) {
+    if (!text_path && !binary_path) {
+        fail(SC_ERR_INVALID_ARGUMENT, "no lexicon path");
+        return nullptr;
+    }
+    sc_lexicon* lex = nullptr;
+    guarded([&]() {
+        std::unique_ptr<sc_lexicon> loading(new sc_lexicon());
+        bool ok;
+        if (binary_path && text_path) ok = loading->gaddag.loadCached(text_path, binary_path);
+        else if (binary_path) ok = loading->gaddag.loadBinary(binary_path);
+        else ok = loading->gaddag.loadFromFile(text_path);
+        if (!ok) return fail(SC_ERR_IO, "could not load lexicon");
+        lex = loading.release();
+        return SC_OK;
+    });
+    return lex;
+}
+
+void sc_lexicon_free(sc_lexicon* lexicon) {
+    delete lexicon;
+}
+
+int sc_lexicon_contains(const sc_lexicon* lexicon, const char* word) {
+    if (!lexicon || !word) return 0;
+    return lexicon->gaddag.contains(word) ? 1 : 0;
+}
+
+sc_position* sc_position_new(void) {
+    return new (std::nothrow) sc_position();
+}
+
+void sc_position_free(sc_position* position) {
+    delete position;
+}
+
+sc_status sc_position_set_board(sc_position* position, const char* board) {
+    if (!position || !board) return fail(SC_ERR_INVALID_ARGUMENT, "null argument");
+    return guarded([&]() {
+        position->board = boardFromString(std::string(board, strnlen(board, SC_BOARD_CHARS)));
+        return SC_OK;
+    });
+}
+
+sc_status sc_position_set_rack(sc_position* position, const char* rack) {
+    if (!position || !rack) return fail(SC_ERR_INVALID_ARGUMENT, "null argument");
+    return guarded([&]() {
+        if (!parseRack(rack, 64, position->rack)) return fail(SC_ERR_INVALID_ARGUMENT, "invalid rack");
+        return SC_OK;
+    });
+}
+
+sc_status sc_position_get_board(const sc_position* position, char* out) {
+    if (!position || !out) return fail(SC_ERR_INVALID_ARGUMENT, "null argument");
+    return guarded([&]() {
+        std::string s = boardToString(position->board);
+        std::memcpy(out, s.c_str(), SC_BOARD_CHARS + 1);
+        return SC_OK;
+    });
+}
+
+sc_status sc_position_apply(sc_position* position, const sc_move* move) {
+    if (!position || !move) return fail(SC_ERR_INVALID_ARGUMENT, "null argument");
+    return guarded([&]() {
+        Move m;
+        if (!fromCMove(position->board, *move, m)) return fail(SC_ERR_INVALID_ARGUMENT, "move does not fit the board");
+        applyMove(position->board, m);
+        return SC_OK;
+    });
+}
+
+sc_generator* sc_generator_new(const sc_lexicon* lexicon) {
+    if (!lexicon) {
+        fail(SC_ERR_INVALID_ARGUMENT, "null lexicon");
+        return nullptr;
+    }
+    sc_generator* generator = nullptr;
+    guarded([&]() {
+        generator = new sc_generator(lexicon);
+        return SC_OK;
+    });
+    return generator;
+}
+
+void sc_generator_free(sc_generator* generator) {
+    delete generator;
+}
+
+sc_status sc_generate(sc_generator* generator, const sc_position* position,
+                      sc_move* out, size_t capacity, size_t* count) {
+    if (!generator || !position || !count || (!out && capacity > 0)) {
+        return fail(SC_ERR_INVALID_ARGUMENT, "null argument");
+    }
+    return guarded([&]() {
+        std::vector<Move> moves = generateScoredMoves(position->board, position->rack,
+                                                      generator->generator, generator->lexicon->gaddag);
+        *count = moves.size();
+        for (size_t i = 0; i < capacity && i < moves.size(); ++i) toCMove(position->board, moves[i], out[i]);
+        return moves.size() > capacity ? fail(SC_ERR_CAPACITY, "output array too small") : SC_OK;
+    });
+}
+
+sc_status sc_generate_batch(sc_generator* generator, const sc_position* const* positions, size_t n,
+                            sc_move* out, size_t capacity, size_t* offsets) {
+    if (!generator || (!positions && n > 0) || !offsets || (!out && capacity > 0)) {
+        return fail(SC_ERR_INVALID_ARGUMENT, "null argument");
+    }
+    return guarded([&]() {
+        bool overflow = false;
+        offsets[0] = 0;
+        for (size_t i = 0; i < n; ++i) {
+            if (!positions[i]) return fail(SC_ERR_INVALID_ARGUMENT, "null position");
+            size_t found = generateInto(generator, positions[i]->board, positions[i]->rack,
+                                        out, capacity, offsets[i], overflow);
+            offsets[i + 1] = offsets[i] + found;
+        }
+        return overflow ? fail(SC_ERR_CAPACITY, "output array too small") : SC_OK;
+    });
+}
+
+sc_status sc_generate_batch_strings(sc_generator* generator, const char* boards, const char* racks,
+                                    size_t n, sc_move* out, size_t capacity, size_t* offsets) {
+    if (!generator || ((!boards || !racks) && n > 0) || !offsets || (!out && capacity > 0)) {
+        return fail(SC_ERR_INVALID_ARGUMENT, "null argument");
+    }
+    return guarded([&]() {
+        bool overflow = false;
+        std::vector<char> rack;
+        offsets[0] = 0;
+        for (size_t i = 0; i < n; ++i) {
+            Board board = boardFromString(std::string(boards + i * SC_BOARD_CHARS, SC_BOARD_CHARS));
+            if (!parseRack(racks + i * SC_RACK_STRIDE, SC_RACK_STRIDE, rack)) {
+                return fail(SC_ERR_INVALID_ARGUMENT, "invalid rack");
+            }
+            size_t found = generateInto(generator, board, rack, out, capacity, offsets[i], overflow);
+            offsets[i + 1] = offsets[i] + found;
+        }
+        return overflow ? fail(SC_ERR_CAPACITY, "output array too small") : SC_OK;
+    });
+}
+
+sc_status sc_best_moves(sc_generator* generator, const sc_position* const* positions, size_t n,
+                        int32_t* scores, sc_move* best) {
+    if (!generator || (!positions && n > 0) || !scores) return fail(SC_ERR_INVALID_ARGUMENT, "null argument");
+    return guarded([&]() {
+        for (size_t i = 0; i < n; ++i) {
+            if (!positions[i]) return fail(SC_ERR_INVALID_ARGUMENT, "null position");
+            const Board& board = positions[i]->board;
+            std::vector<Move> moves = generateScoredMoves(board, positions[i]->rack,
+                                                          generator->generator, generator->lexicon->gaddag);
+            size_t top = 0;
+            for (size_t k = 1; k < moves.size(); ++k) {
+                if (moves[k].score > moves[top].score) top = k;
+            }
+            scores[i] = moves.empty() ? 0 : moves[top].score;
+            if (best) {
+                if (moves.empty()) std::memset(&best[i], 0, sizeof(sc_move));
+                else toCMove(board, moves[top], best[i]);
+            }
+        }
+        return SC_OK;
+    });
+}
+
+size_t sc_encoder_sample_size(void) {
+    return ENCODER_SAMPLE_SIZE;
+}
+
+sc_status sc_encode_positions(sc_generator* generator, const sc_position* const* positions,
+                              size_t n, float* out) {
+    if (!generator || ((!positions || !out) && n > 0)) return fail(SC_ERR_INVALID_ARGUMENT, "null argument");
+    return guarded([&]() {
+        for (size_t i = 0; i < n; ++i) {
+            if (!positions[i]) return fail(SC_ERR_INVALID_ARGUMENT, "null position");
+            generator->encoder.encodePositions(&positions[i]->board, 1, out + i * ENCODER_SAMPLE_SIZE);
+        }
+        return SC_OK;
+    });
+}
+
+sc_status sc_encode_moves(sc_generator* generator, const sc_position* position,
+                          const sc_move* moves, size_t n, float* out) {
+    if (!generator || !position || ((!moves || !out) && n > 0)) return fail(SC_ERR_INVALID_ARGUMENT, "null argument");
+    return guarded([&]() {
+        std::vector<Move> converted(n);
+        for (size_t i = 0; i < n; ++i) {
+            if (!fromCMove(position->board, moves[i], converted[i])) {
+                return fail(SC_ERR_INVALID_ARGUMENT, "move does not fit the board");
+            }
+        }
+        generator->encoder.encodeMoves(position->board, converted.data(), n, out);
+        return SC_OK;
+    });
+}
+
+}
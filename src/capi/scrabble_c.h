@@ -0,0 +1,157 @@
+#ifndef SCRABBLE_C_H
+#define SCRABBLE_C_H
+
+/*
+ * Stable C ABI for the Scrabble engine (libscrabble_c).
+ *
+ * Designed for FFI consumers (Python ctypes/cffi, ...):
+ *   - Only opaque handles and plain C structs cross the boundary.
+ *   - Batched calls fill caller-owned arrays, so one call can return thousands
+ *     of moves or encoded samples without per-object marshalling.
+ *   - Functions never throw; they return an sc_status and set a thread-local
+ *     message readable with sc_last_error().
+ *
+ * Versioning: SC_ABI_VERSION is bumped on any incompatible change. Callers should
+ * compare it with sc_abi_version() at load time. Struct layouts are fixed and
+ * checked by static assertions in the implementation.
+ *
+ * Thread safety: a lexicon may be shared by any number of generators and threads.
+ * A generator or a position must only be used by one thread at a time.
+ *
+ * Board strings use the benchmark format: 225 characters, row-major, '.' for an
+ * empty square, upper case for tiles and lower case for blanks.
+ * Racks are strings of upper case letters, '?' (or '*') for blanks.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if defined(_WIN32)
+#define SC_API __declspec(dllexport)
+#else
+#define SC_API __attribute__((visibility("default")))
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define SC_ABI_VERSION 1u
+
+#define SC_BOARD_CHARS 225  /* Characters in a board string (without terminator) */
+#define SC_RACK_STRIDE 8    /* Bytes per rack in batched string inputs (NUL padded) */
+#define SC_MAX_WORD 16      /* Bytes of sc_move.word (NUL terminated) */
+
+typedef enum sc_status {
+    SC_OK = 0,
+    SC_ERR_INVALID_ARGUMENT = -1,
+    SC_ERR_IO = -2,
+    SC_ERR_CAPACITY = -3,   /* Output array too small; counts report the size needed */
+    SC_ERR_INTERNAL = -4
+} sc_status;
+
+typedef struct sc_lexicon sc_lexicon;
+typedef struct sc_position sc_position;
+typedef struct sc_generator sc_generator;
+
+/* One legal move. 28 bytes, no padding. */
+typedef struct sc_move {
+    int8_t row;             /* Start square */
+    int8_t col;
+    uint8_t horizontal;     /* 1 = horizontal, 0 = vertical */
+    uint8_t tile_count;     /* Tiles placed from the rack */
+    int32_t score;          /* Full score (premiums, cross-words, bingo) */
+    char word[SC_MAX_WORD]; /* Main word, upper case, NUL terminated */
+    uint16_t blank_mask;    /* Bit i set if word[i] is a blank placed by this move */
+    uint16_t reserved;
+} sc_move;
+
+/* ABI version of the loaded library (compare with SC_ABI_VERSION). */
+SC_API uint32_t sc_abi_version(void);
+
+/* Message describing the last error on the calling thread ("" if none). */
+SC_API const char* sc_last_error(void);
+
+/* --- Lexicon --- */
+
+/*
+ * Load a lexicon. If binary_path is non-NULL and exists it is used; otherwise the
+ * word list is loaded (and the binary cache written when binary_path is given).
+ * Returns NULL on failure.
+ */
+SC_API sc_lexicon* sc_lexicon_load(const char* text_path, const char* binary_path);
+SC_API void sc_lexicon_free(sc_lexicon* lexicon);
+
+/* 1 if the word is in the lexicon, 0 otherwise (or on invalid arguments). */
+SC_API int sc_lexicon_contains(const sc_lexicon* lexicon, const char* word);
+
+/* --- Position (board + rack) --- */
+
+SC_API sc_position* sc_position_new(void);
+SC_API void sc_position_free(sc_position* position);
+
+/* board: SC_BOARD_CHARS characters (a terminator is not required). */
+SC_API sc_status sc_position_set_board(sc_position* position, const char* board);
+/* rack: NUL-terminated, at most 7 tiles. */
+SC_API sc_status sc_position_set_rack(sc_position* position, const char* rack);
+/* out: at least SC_BOARD_CHARS + 1 bytes; written NUL terminated. */
+SC_API sc_status sc_position_get_board(const sc_position* position, char* out);
+/* Apply a move returned by the generator for this position (rack is not changed). */
+SC_API sc_status sc_position_apply(sc_position* position, const sc_move* move);
+
+/* --- Generator --- */
+
+/* The lexicon must outlive the generator. */
+SC_API sc_generator* sc_generator_new(const sc_lexicon* lexicon);
+SC_API void sc_generator_free(sc_generator* generator);
+
+/*
+ * Generate all legal moves (both directions, scored) for one position.
+ * Writes up to `capacity` moves to `out` and the total number found to *count.
+ * Returns SC_ERR_CAPACITY if the moves did not fit (out holds the first `capacity`).
+ */
+SC_API sc_status sc_generate(sc_generator* generator, const sc_position* position,
+                             sc_move* out, size_t capacity, size_t* count);
+
+/*
+ * Generate moves for `n` positions in one call.
+ * Moves of position i are written to out[offsets[i] .. offsets[i + 1]).
+ * offsets must hold n + 1 entries. On SC_ERR_CAPACITY, offsets still describe
+ * the full result (offsets[n] = capacity needed) but only whole positions that
+ * fit were written.
+ */
+SC_API sc_status sc_generate_batch(sc_generator* generator, const sc_position* const* positions, size_t n,
+                                   sc_move* out, size_t capacity, size_t* offsets);
+
+/*
+ * Same as sc_generate_batch, from raw strings without position handles:
+ * boards holds n * SC_BOARD_CHARS characters, racks holds n * SC_RACK_STRIDE bytes.
+ */
+SC_API sc_status sc_generate_batch_strings(sc_generator* generator, const char* boards, const char* racks,
+                                           size_t n, sc_move* out, size_t capacity, size_t* offsets);
+
+/*
+ * Fill scores[i] with the score of the best move of position i (0 if none),
+ * and best (if non-NULL) with that move.
+ */
+SC_API sc_status sc_best_moves(sc_generator* generator, const sc_position* const* positions, size_t n,
+                               int32_t* scores, sc_move* best);
+
+/* --- Tensor encoding (see src/engine/Encoder.h for the plane layout) --- */
+
+/* Number of values in one encoded sample. */
+SC_API size_t sc_encoder_sample_size(void);
+
+/* out: n * sc_encoder_sample_size() floats. */
+SC_API sc_status sc_encode_positions(sc_generator* generator, const sc_position* const* positions,
+                                     size_t n, float* out);
+
+/* Encode n moves of one position (post-move boards). out: n * sc_encoder_sample_size() floats. */
+SC_API sc_status sc_encode_moves(sc_generator* generator, const sc_position* position,
+                                 const sc_move* moves, size_t n, float* out);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SCRABBLE_C_H */
@@ -0,0 +1,120 @@
+#include "Anagram.h"
+#include "Rules.h"
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <thread>
+
+namespace Scrabble {
+
+    struct AnagramSearch {
+        const AnagramQuery& query;
+        int counts[26];
+        int blanks;
+        int tiles;
+        char path[16];        // Letters walked so far: the word reversed
+        bool fromBlank[16];
+        std::vector<AnagramMatch>& out;
+
+        AnagramSearch(const AnagramQuery& q, std::vector<AnagramMatch>& results)
+            : query(q), counts(), blanks(0), tiles(0), out(results) {}
+
+        bool full() const { return query.limit > 0 && out.size() >= query.limit; }
+
+        void emit(int depth, int blanksUsed) {
+            AnagramMatch match;
+            match.word.resize(depth);
+            for (int i = 0; i < depth; ++i) {
+                char c = path[depth - 1 - i];
+                match.word[i] = fromBlank[depth - 1 - i] ? (char)std::tolower(c) : c;
+            }
+            match.blanksUsed = blanksUsed;
+            out.push_back(match);
+        }
+
+        void step(const Node* node, char letter, int depth, int blanksUsed, bool blank) {
+            path[depth] = letter;
+            fromBlank[depth] = blank;
+            walk(node, depth + 1, blanksUsed + (blank ? 1 : 0));
+        }
+
+        void walk(const Node* node, int depth, int blanksUsed) {
+            if (full()) return;
+            if (depth >= query.minLength && (!query.exact || depth == tiles)) {
+                auto end = node->children.find(GADDAG_DELIMITER);
+                if (end != node->children.end() && end->second->isTerminal) emit(depth, blanksUsed);
+            }
+            if (depth == tiles || depth >= (int)sizeof(path)) return;
+
+            if (blanks > 0) {
+                // Any letter: real tile when we have one, blank otherwise
+                for (const auto& child : node->children) {
+                    char letter = child.first;
+                    if (letter < 'A' || letter > 'Z') continue;
+                    int& count = counts[letter - 'A'];
+                    if (count > 0) {
+                        count--;
+                        step(child.second, letter, depth, blanksUsed, false);
+                        count++;
+                    } else {
+                        blanks--;
+                        step(child.second, letter, depth, blanksUsed, true);
+                        blanks++;
+                    }
+                }
+                return;
+            }
+            for (int l = 0; l < 26; ++l) {
+                if (counts[l] == 0) continue;
+                auto child = node->children.find((char)('A' + l));
+                if (child == node->children.end()) continue;
+                counts[l]--;
+                step(child->second, (char)('A' + l), depth, blanksUsed, false);
+                counts[l]++;
+            }
+        }
+    };
+
+    std::vector<AnagramMatch> findAnagrams(const Gaddag& gaddag, const std::string& rack, const AnagramQuery& query) {
+        std::vector<AnagramMatch> results;
+        AnagramSearch search(query, results);
+        for (char c : rack) {
+            if (isBlankTile(c)) {
+                search.blanks++;
+            } else if (std::isalpha((unsigned char)c)) {
+                search.counts[std::toupper((unsigned char)c) - 'A']++;
+            } else {
+                continue;
+            }
+            search.tiles++;
+        }
+        if (query.exact && search.tiles < query.minLength) return results;
+        search.walk(gaddag.getRoot(), 0, 0);
+
+        std::sort(results.begin(), results.end(), [](const AnagramMatch& a, const AnagramMatch& b) {
+            if (a.word.length() != b.word.length()) return a.word.length() > b.word.length();
+            // Blank letters (lower case) sort with their upper case form
+            return std::lexicographical_compare(a.word.begin(), a.word.end(), b.word.begin(), b.word.end(),
+                                                [](char x, char y) { return std::toupper(x) < std::toupper(y); });
+        });
+        return results;
+    }
+
+    std::vector<std::vector<AnagramMatch>> findAnagramsBatch(const Gaddag& gaddag, const std::vector<std::string>& racks,
+                                                             const AnagramQuery& query, int threads) {
+        std::vector<std::vector<AnagramMatch>> results(racks.size());
+        std::atomic<size_t> next(0);
+        auto worker = [&]() {
+            size_t i;
+            while ((i = next++) < racks.size()) results[i] = findAnagrams(gaddag, racks[i], query);
+        };
+
+        int threadCount = std::max(1, threads);
+        std::vector<std::thread> pool;
+        for (int t = 1; t < threadCount; ++t) pool.emplace_back(worker);
+        worker();
+        for (std::thread& t : pool) t.join();
+        return results;
+    }
+
+}
@@ -0,0 +1,56 @@
+#ifndef ANAGRAM_H
+#define ANAGRAM_H
+
+#include "Gaddag.h"
+#include <vector>
+#include <string>
+
+namespace Scrabble {
+
+    /*
+     * Rack-only word queries: which words can be made from a set of letters.
+     *
+     * Every word W is stored in the GADDAG as the path reverse(W) followed by the
+     * delimiter, so walking the GADDAG from the root with the letter counts of
+     * the rack visits each candidate word exactly once, and no board is needed.
+     * Blanks ('?' or '*') stand for any letter; a real tile is always used in
+     * preference to a blank, so each word is reported once.
+     */
+
+    struct AnagramQuery {
+        bool exact = false;   // Use every tile of the rack (anagrams), otherwise any subset (sub-anagrams)
+        int minLength = 2;    // Shortest word to report
+        size_t limit = 0;     // Stop the walk after this many words (0 = no limit); which ones are kept is unspecified
+    };
+
+    struct AnagramMatch {
+        std::string word;     // Upper case, letters supplied by a blank in lower case
+        int blanksUsed;
+    };
+
+    /**
+     * Words that can be made from a rack.
+     * Results are sorted by decreasing length, then alphabetically.
+     * @param gaddag Dictionary
+     * @param rack Letters (upper or lower case) and blanks
+     * @param query Exact or sub-anagrams, minimum length, limit
+     * @return Matching words
+     */
+    std::vector<AnagramMatch> findAnagrams(const Gaddag& gaddag, const std::string& rack,
+                                           const AnagramQuery& query = AnagramQuery());
+
+    /**
+     * Same query for many racks, spread over worker threads.
+     * @param gaddag Dictionary
+     * @param racks Racks to solve
+     * @param query Query applied to every rack
+     * @param threads Worker threads (1 = calling thread only)
+     * @return One result list per rack, in input order
+     */
+    std::vector<std::vector<AnagramMatch>> findAnagramsBatch(const Gaddag& gaddag, const std::vector<std::string>& racks,
+                                                             const AnagramQuery& query = AnagramQuery(),
+                                                             int threads = 1);
+
+}
+
+#endif // ANAGRAM_H
@@ -0,0 +1,251 @@
+#include "Corpus.h"
+#include "Game.h"
+#include "Rules.h"
+#include "SelfPlay.h"
+#include "TrainingData.h"
+#include <algorithm>
+#include <atomic>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <thread>
+#include <cstring>
+
+namespace Scrabble {
+
+    static const char CORPUS_MAGIC[8] = {'S', 'C', 'R', 'B', 'C', 'P', '0', '1'};
+
+    struct CorpusHeader {
+        char magic[8];
+        uint32_t version;
+        uint32_t count;
+    };
+
+    struct CorpusRecord {
+        uint8_t board[TD_BOARD_BYTES];
+        char rack[CORPUS_RACK_BYTES];
+        uint8_t positionClass;
+        uint8_t reserved[6];
+    };
+
+    static_assert(sizeof(CorpusHeader) == 16, "CorpusHeader layout");
+    static_assert(sizeof(CorpusRecord) == 240, "CorpusRecord layout");
+
+    const char* positionClassName(PositionClass positionClass) {
+        switch (positionClass) {
+            case PositionClass::Opening: return "opening";
+            case PositionClass::Midgame: return "midgame";
+            case PositionClass::Lategame: return "lategame";
+            case PositionClass::BlankHeavy: return "blanks";
+            case PositionClass::Cramped: return "cramped";
+            default: return "unknown";
+        }
+    }
+
+    bool positionClassByName(const std::string& name, PositionClass& positionClass) {
+        for (int i = 0; i < (int)PositionClass::Count; ++i) {
+            if (name == positionClassName((PositionClass)i)) {
+                positionClass = (PositionClass)i;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    static int countTiles(const Board& board) {
+        int tiles = 0;
+        for (int r = 0; r < 15; ++r) {
+            for (int c = 0; c < 15; ++c) {
+                if (!board.isEmpty(r, c)) tiles++;
+            }
+        }
+        return tiles;
+    }
+
+    static int countBlanks(const Board& board) {
+        int blanks = 0;
+        for (int r = 0; r < 15; ++r) {
+            for (int c = 0; c < 15; ++c) {
+                if (board.getTile(r, c).isBlank()) blanks++;
+            }
+        }
+        return blanks;
+    }
+
+    // Strong but varied play: a random pick among the five best scores
+    static int pickNearBest(const std::vector<Move>& moves, std::mt19937_64& rng) {
+        if (moves.empty()) return -1;
+        std::vector<int> order(moves.size());
+        for (size_t i = 0; i < order.size(); ++i) order[i] = (int)i;
+        size_t k = std::min<size_t>(5, order.size());
+        std::partial_sort(order.begin(), order.begin() + k, order.end(), [&](int a, int b) {
+            return moves[a].score > moves[b].score;
+        });
+        std::uniform_int_distribution<size_t> dist(0, k - 1);
+        return order[dist(rng)];
+    }
+
+    // Short, high-scoring placements: many cross-words, so the board packs tightly
+    static int pickDense(const std::vector<Move>& moves) {
+        int best = -1;
+        for (size_t i = 0; i < moves.size(); ++i) {
+            if (moves[i].tileCount > 2) continue;
+            if (best < 0 || moves[i].score > moves[best].score) best = (int)i;
+        }
+        return best >= 0 ? best : (moves.empty() ? -1 : 0);
+    }
+
+    CorpusPosition generatePosition(const Gaddag& gaddag, PositionClass positionClass, uint64_t seed) {
+        std::mt19937_64 rng(seed);
+        Game game(seed);
+        MoveGenerator generator;
+
+        // When to stop, per class
+        int targetTurn = -1;
+        size_t targetBag = 0;
+        if (positionClass == PositionClass::Opening) {
+            targetTurn = std::uniform_int_distribution<int>(0, 2)(rng);
+        } else if (positionClass == PositionClass::Midgame) {
+            targetTurn = std::uniform_int_distribution<int>(6, 14)(rng);
+        } else if (positionClass == PositionClass::BlankHeavy) {
+            targetTurn = std::uniform_int_distribution<int>(6, 24)(rng);
+        } else if (positionClass == PositionClass::Lategame) {
+            targetBag = std::uniform_int_distribution<size_t>(0, RACK_SIZE)(rng);
+        }
+
+        CorpusPosition position;
+        position.positionClass = positionClass;
+        while (true) {
+            position.board = game.getBoard();
+            position.rack = game.getRack(game.currentPlayer());
+            if (game.isOver()) break;
+
+            bool reached = false;
+            switch (positionClass) {
+                case PositionClass::Lategame: reached = game.bagSize() <= targetBag; break;
+                case PositionClass::Cramped: reached = countTiles(game.getBoard()) >= 60; break;
+                default: reached = game.turnNumber() >= targetTurn; break;
+            }
+            if (reached) break;
+
+            std::vector<Move> moves = game.legalMoves(generator, gaddag);
+            int choice = positionClass == PositionClass::Cramped ? pickDense(moves) : pickNearBest(moves, rng);
+            if (choice >= 0 && game.play(moves[choice])) continue;
+            if (!game.exchange(game.getRack(game.currentPlayer()))) game.pass();
+        }
+
+        if (positionClass == PositionClass::BlankHeavy) {
+            // Turn regular tiles into blanks until the rack holds every blank not yet on the board
+            int spare = letterCount(BLANK_TILE) - countBlanks(position.board);
+            int blanks = (int)std::count_if(position.rack.begin(), position.rack.end(), isBlankTile);
+            std::shuffle(position.rack.begin(), position.rack.end(), rng);
+            for (char& c : position.rack) {
+                if (blanks >= spare) break;
+                if (isBlankTile(c)) continue;
+                c = BLANK_TILE;
+                blanks++;
+            }
+        }
+        return position;
+    }
+
+    std::vector<CorpusPosition> generateCorpus(const Gaddag& gaddag, const CorpusConfig& config) {
+        std::vector<PositionClass> classes = config.classes;
+        if (classes.empty()) {
+            for (int i = 0; i < (int)PositionClass::Count; ++i) classes.push_back((PositionClass)i);
+        }
+
+        std::vector<CorpusPosition> positions(config.count);
+        std::atomic<size_t> next(0);
+        auto worker = [&]() {
+            size_t i;
+            while ((i = next++) < config.count) {
+                positions[i] = generatePosition(gaddag, classes[i % classes.size()], gameSeed(config.seed, i));
+            }
+        };
+
+        int threadCount = std::max(1, config.threads);
+        std::vector<std::thread> threads;
+        for (int t = 1; t < threadCount; ++t) threads.emplace_back(worker);
+        worker();
+        for (std::thread& t : threads) t.join();
+        return positions;
+    }
+
+    bool writeCorpusText(const std::string& path, const std::vector<CorpusPosition>& positions) {
+        std::ofstream out(path);
+        if (!out.is_open()) {
+            std::cerr << "Error opening corpus file for writing: " << path << std::endl;
+            return false;
+        }
+        for (const CorpusPosition& p : positions) {
+            out << boardToString(p.board) << " | " << std::string(p.rack.begin(), p.rack.end()) << '\n';
+        }
+        return out.good();
+    }
+
+    bool writeCorpusBinary(const std::string& path, const std::vector<CorpusPosition>& positions) {
+        std::ofstream out(path, std::ios::binary);
+        if (!out.is_open()) {
+            std::cerr << "Error opening corpus file for writing: " << path << std::endl;
+            return false;
+        }
+        CorpusHeader header;
+        std::memcpy(header.magic, CORPUS_MAGIC, sizeof(header.magic));
+        header.version = CORPUS_VERSION;
+        header.count = (uint32_t)positions.size();
+        out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+        for (const CorpusPosition& p : positions) {
+            CorpusRecord record;
+            std::memset(&record, 0, sizeof(record));
+            encodeBoardBytes(p.board, record.board);
+            for (size_t i = 0; i < p.rack.size() && i < (size_t)CORPUS_RACK_BYTES; ++i) record.rack[i] = p.rack[i];
+            record.positionClass = (uint8_t)p.positionClass;
+            out.write(reinterpret_cast<const char*>(&record), sizeof(record));
+        }
+        return out.good();
+    }
+
+    bool readCorpusBinary(const std::string& path, std::vector<CorpusPosition>& positions) {
+        std::ifstream in(path, std::ios::binary | std::ios::ate);
+        if (!in.is_open()) {
+            std::cerr << "Error opening corpus file for reading: " << path << std::endl;
+            return false;
+        }
+        uint64_t size = (uint64_t)in.tellg();
+        in.seekg(0);
+        CorpusHeader header;
+        in.read(reinterpret_cast<char*>(&header), sizeof(header));
+        // The count is checked against the file before anything is reserved
+        if (!in || std::memcmp(header.magic, CORPUS_MAGIC, sizeof(header.magic)) != 0 ||
+            header.version != CORPUS_VERSION || header.count > (size - sizeof(header)) / sizeof(CorpusRecord)) {
+            std::cerr << "Invalid corpus file: " << path << std::endl;
+            return false;
+        }
+
+        positions.clear();
+        positions.reserve(header.count);
+        for (uint32_t n = 0; n < header.count; ++n) {
+            CorpusRecord record;
+            in.read(reinterpret_cast<char*>(&record), sizeof(record));
+            if (!in || record.positionClass >= (uint8_t)PositionClass::Count) {
+                std::cerr << "Invalid corpus file: " << path << std::endl;
+                return false;
+            }
+            CorpusPosition p;
+            for (int i = 0; i < TD_BOARD_BYTES; ++i) {
+                uint8_t b = record.board[i];
+                if (b == 0) continue;
+                char letter = (char)('A' + (b & 0x7F) - 1);
+                bool blank = (b & 0x80) != 0;
+                p.board.setTile(i / 15, i % 15, Tile(letter, blank ? 0 : letterValue(letter)));
+            }
+            for (int i = 0; i < CORPUS_RACK_BYTES && record.rack[i] != '\0'; ++i) p.rack.push_back(record.rack[i]);
+            p.positionClass = (PositionClass)record.positionClass;
+            positions.push_back(p);
+        }
+        return true;
+    }
+
+}
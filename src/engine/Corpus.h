@@ -0,0 +1,97 @@
+#ifndef CORPUS_H
+#define CORPUS_H
+
+#include "engine.h"
+#include "Gaddag.h"
+#include <vector>
+#include <string>
+#include <cstdint>
+
+namespace Scrabble {
+
+    /*
+     * Benchmark position corpora, generated by playing seeded games.
+     *
+     * Text form: the synthetic_positions.txt format, one "<board> | <rack>" line
+     * per position (225-character board, '?' for blanks in the rack).
+     *
+     * Binary form (little-endian):
+     *   CorpusHeader (16)          magic "SCRBCP01", version, position count
+     *   CorpusRecord[count] (240)  board bytes, rack, class
+     */
+
+    enum class PositionClass : uint8_t {
+        Opening = 0,    // Empty board or after one or two moves
+        Midgame,        // 6 to 14 moves in
+        Lategame,       // Bag (nearly) empty
+        BlankHeavy,     // Mid or late game, the rack holds every blank not already on the board
+        Cramped,        // Dense board built from short placements
+        Count
+    };
+
+    const uint32_t CORPUS_VERSION = 1;
+    const int CORPUS_RACK_BYTES = 8;  // Rack characters, NUL padded
+
+    struct CorpusPosition {
+        Board board;
+        std::vector<char> rack;
+        PositionClass positionClass;
+    };
+
+    struct CorpusConfig {
+        size_t count = 1000;
+        uint64_t seed = 1;
+        int threads = 1;
+        std::vector<PositionClass> classes;  // Empty = all classes, in equal shares
+    };
+
+    /**
+     * Name of a class as used on the command line ("opening", "midgame", ...).
+     */
+    const char* positionClassName(PositionClass positionClass);
+
+    /**
+     * Parse a class name.
+     * @return false if the name is unknown
+     */
+    bool positionClassByName(const std::string& name, PositionClass& positionClass);
+
+    /**
+     * Generate one position of a class. Same seed, same position.
+     * @param gaddag Dictionary
+     * @param positionClass Class to generate
+     * @param seed Game seed
+     */
+    CorpusPosition generatePosition(const Gaddag& gaddag, PositionClass positionClass, uint64_t seed);
+
+    /**
+     * Generate a corpus. Position i has class classes[i % classes.size()] and
+     * seed gameSeed(seed, i), so the result does not depend on the thread count.
+     * @param gaddag Dictionary
+     * @param config Size, seed, threads and classes
+     */
+    std::vector<CorpusPosition> generateCorpus(const Gaddag& gaddag, const CorpusConfig& config);
+
+    /**
+     * Write positions in the text format.
+     * @return false on I/O error
+     */
+    bool writeCorpusText(const std::string& path, const std::vector<CorpusPosition>& positions);
+
+    /**
+     * Write positions in the binary format.
+     * @return false on I/O error
+     */
+    bool writeCorpusBinary(const std::string& path, const std::vector<CorpusPosition>& positions);
+
+    /**
+     * Read a binary corpus.
+     * @param path Input path
+     * @param positions Output positions
+     * @return false if the file is missing or invalid
+     */
+    bool readCorpusBinary(const std::string& path, std::vector<CorpusPosition>& positions);
+
+}
+
+#endif // CORPUS_H
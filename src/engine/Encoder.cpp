@@ -0,0 +1,141 @@
+#include "Encoder.h"
+#include <cstring>
+
+namespace Scrabble {
+
+    // Bonus planes depend only on the (fixed) layout: build them once
+    struct BonusPlanes {
+        uint8_t planes[4][225];
+
+        BonusPlanes() {
+            std::memset(planes, 0, sizeof(planes));
+            Board board;
+            for (int sq = 0; sq < 225; ++sq) {
+                switch (board.getBonus(sq / 15, sq % 15)) {
+                    case Bonus::DoubleLetter: planes[0][sq] = 1; break;
+                    case Bonus::TripleLetter: planes[1][sq] = 1; break;
+                    case Bonus::DoubleWord: planes[2][sq] = 1; break;
+                    case Bonus::TripleWord: planes[3][sq] = 1; break;
+                    default: break;
+                }
+            }
+        }
+    };
+
+    static const BonusPlanes& bonusPlanes() {
+        static const BonusPlanes planes;
+        return planes;
+    }
+
+    // Copy raw generator output into square-indexed tables, clearing occupied squares
+    static void fillChecks(const Tile* tiles, const uint32_t horizontal[15][15],
+                           const uint32_t vertical[15][15], uint32_t outH[225], uint32_t outV[225]) {
+        for (int r = 0; r < 15; ++r) {
+            for (int c = 0; c < 15; ++c) {
+                int sq = r * 15 + c;
+                bool empty = tiles[sq].isEmpty();
+                outH[sq] = empty ? horizontal[r][c] : 0;
+                outV[sq] = empty ? vertical[c][r] : 0; // vertical comes from the transposed board
+            }
+        }
+    }
+
+    void BoardEncoder::computeChecks(const Board& board, CrossChecks& checks) const {
+        uint32_t horizontal[15][15];
+        uint32_t vertical[15][15];
+        generator.computeCrossChecks(board, gaddag, horizontal);
+        generator.computeCrossChecks(board.transposed(), gaddag, vertical);
+        fillChecks(board.tileData(), horizontal, vertical, checks.horizontal, checks.vertical);
+    }
+
+    template <typename T>
+    void BoardEncoder::encodeOne(const Board& board, const CrossChecks& checks, T* out) const {
+        std::memset(out, 0, ENCODER_SAMPLE_SIZE * sizeof(T));
+
+        const BonusPlanes& bonus = bonusPlanes();
+        for (int b = 0; b < 4; ++b) {
+            T* plane = out + (size_t)(ENCODER_PLANE_BONUS + b) * ENCODER_PLANE_STRIDE;
+            for (int sq = 0; sq < 225; ++sq) plane[sq] = (T)bonus.planes[b][sq];
+        }
+
+        const Tile* tiles = board.tileData();
+        for (int sq = 0; sq < 225; ++sq) {
+            const Tile& t = tiles[sq];
+            if (t.isEmpty()) continue;
+            out[(size_t)(ENCODER_PLANE_LETTERS + (t.letter - 'A')) * ENCODER_PLANE_STRIDE + sq] = (T)1;
+            if (t.isBlank()) out[(size_t)ENCODER_PLANE_BLANK * ENCODER_PLANE_STRIDE + sq] = (T)1;
+        }
+
+        // Letter-major loops: one contiguous plane at a time, branch-free inner loop
+        for (int l = 0; l < 26; ++l) {
+            T* planeH = out + (size_t)(ENCODER_PLANE_CROSS_H + l) * ENCODER_PLANE_STRIDE;
+            T* planeV = out + (size_t)(ENCODER_PLANE_CROSS_V + l) * ENCODER_PLANE_STRIDE;
+            for (int sq = 0; sq < 225; ++sq) {
+                planeH[sq] = (T)((checks.horizontal[sq] >> l) & 1u);
+                planeV[sq] = (T)((checks.vertical[sq] >> l) & 1u);
+            }
+        }
+    }
+
+    template <typename T>
+    void BoardEncoder::encodeMoveBatch(const Board& board, const Move* moves, size_t count, T* out) const {
+        if (count == 0) return;
+
+        CrossChecks checks;
+        computeChecks(board, checks);
+        encodeOne(board, checks, out);
+        for (size_t i = 1; i < count; ++i) {
+            std::memcpy(out + i * ENCODER_SAMPLE_SIZE, out, ENCODER_SAMPLE_SIZE * sizeof(T));
+        }
+
+        const Tile* tiles = board.tileData();
+        for (size_t i = 0; i < count; ++i) {
+            const Move& m = moves[i];
+            T* sample = out + i * ENCODER_SAMPLE_SIZE;
+            int step = m.horizontal ? 1 : 15;
+            int sq = m.row * 15 + m.col;
+            int placed = 0;
+
+            for (size_t k = 0; k < m.word.length() && placed < m.tileCount; ++k, sq += step) {
+                if (sq < 0 || sq >= 225 || !tiles[sq].isEmpty()) continue;
+                const Tile& t = m.tiles[placed++];
+                if (t.letter < 'A' || t.letter > 'Z') continue;
+                sample[(size_t)(ENCODER_PLANE_LETTERS + (t.letter - 'A')) * ENCODER_PLANE_STRIDE + sq] = (T)1;
+                if (t.isBlank()) sample[(size_t)ENCODER_PLANE_BLANK * ENCODER_PLANE_STRIDE + sq] = (T)1;
+                sample[(size_t)ENCODER_PLANE_PLACED * ENCODER_PLANE_STRIDE + sq] = (T)1;
+            }
+        }
+    }
+
+    void BoardEncoder::encodePositions(const Board* boards, size_t count, float* out) const {
+        CrossChecks checks;
+        for (size_t i = 0; i < count; ++i) {
+            computeChecks(boards[i], checks);
+            encodeOne(boards[i], checks, out + i * ENCODER_SAMPLE_SIZE);
+        }
+    }
+
+    void BoardEncoder::encodePositions(const Board* boards, size_t count, uint8_t* out) const {
+        CrossChecks checks;
+        for (size_t i = 0; i < count; ++i) {
+            computeChecks(boards[i], checks);
+            encodeOne(boards[i], checks, out + i * ENCODER_SAMPLE_SIZE);
+        }
+    }
+
+    void BoardEncoder::encodePosition(const Board& board, const uint32_t horizontal[15][15],
+                                      const uint32_t vertical[15][15], float* out) const {
+        CrossChecks checks;
+        fillChecks(board.tileData(), horizontal, vertical, checks.horizontal, checks.vertical);
+        encodeOne(board, checks, out);
+    }
+
+    void BoardEncoder::encodeMoves(const Board& board, const Move* moves, size_t count, float* out) const {
+        encodeMoveBatch(board, moves, count, out);
+    }
+
+    void BoardEncoder::encodeMoves(const Board& board, const Move* moves, size_t count, uint8_t* out) const {
+        encodeMoveBatch(board, moves, count, out);
+    }
+
+}
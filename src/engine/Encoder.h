@@ -0,0 +1,97 @@
+#ifndef ENCODER_H
+#define ENCODER_H
+
+#include "engine.h"
+#include "Gaddag.h"
+#include "MoveGenerator.h"
+#include <cstddef>
+#include <cstdint>
+
+namespace Scrabble {
+
+    /**
+     * Converts positions and candidate moves into dense input planes for neural evaluation.
+     *
+     * Layout is planar (NCHW): one sample = ENCODER_PLANES planes, each plane holds the
+     * 225 squares row-major and is padded to ENCODER_PLANE_STRIDE (256) values so that
+     * every plane starts on a 64-byte boundary (for both float and uint8 buffers, given
+     * an aligned base). Padding values are zero.
+     *
+     * Planes:
+     *   0..25   letter one-hot (blanks included, under the letter they stand for)
+     *   26      blank tiles
+     *   27..30  double letter, triple letter, double word, triple word squares
+     *   31..56  horizontal cross-checks: letter allowed on an empty square in a horizontal play
+     *   57..82  vertical cross-checks
+     *   83      tiles placed by the encoded move (all zero for plain positions)
+     *
+     * Cross-checks always describe the position before the move.
+     */
+    const int ENCODER_PLANE_LETTERS = 0;
+    const int ENCODER_PLANE_BLANK = 26;
+    const int ENCODER_PLANE_BONUS = 27;
+    const int ENCODER_PLANE_CROSS_H = 31;
+    const int ENCODER_PLANE_CROSS_V = 57;
+    const int ENCODER_PLANE_PLACED = 83;
+    const int ENCODER_PLANES = 84;
+    const int ENCODER_PLANE_STRIDE = 256;
+    const size_t ENCODER_SAMPLE_SIZE = (size_t)ENCODER_PLANES * ENCODER_PLANE_STRIDE;
+
+    class BoardEncoder {
+    private:
+        const Gaddag& gaddag;
+        const MoveGenerator& generator;
+
+        // Both cross-check tables of a position, indexed row * 15 + col
+        struct CrossChecks {
+            uint32_t horizontal[225];
+            uint32_t vertical[225];
+        };
+
+        void computeChecks(const Board& board, CrossChecks& checks) const;
+
+        template <typename T>
+        void encodeOne(const Board& board, const CrossChecks& checks, T* out) const;
+
+        template <typename T>
+        void encodeMoveBatch(const Board& board, const Move* moves, size_t count, T* out) const;
+
+    public:
+        BoardEncoder(const Gaddag& gaddag, const MoveGenerator& generator)
+            : gaddag(gaddag), generator(generator) {}
+
+        /**
+         * Encode a batch of positions into a caller-provided buffer.
+         * @param boards Array of `count` boards
+         * @param count Batch size
+         * @param out Buffer of count * ENCODER_SAMPLE_SIZE values
+         */
+        void encodePositions(const Board* boards, size_t count, float* out) const;
+        void encodePositions(const Board* boards, size_t count, uint8_t* out) const;
+
+        /**
+         * Encode one position whose cross-checks the caller already computed
+         * (e.g. from MoveGenerator::computeCrossChecks on the board and its transpose).
+         * @param board The position
+         * @param horizontal Horizontal cross-checks of board
+         * @param vertical Horizontal cross-checks of board.transposed(), indexed [col][row]
+         * @param out Buffer of ENCODER_SAMPLE_SIZE values
+         */
+        void encodePosition(const Board& board, const uint32_t horizontal[15][15],
+                            const uint32_t vertical[15][15], float* out) const;
+
+        /**
+         * Encode a batch of candidate moves on one position: each sample is the
+         * post-move board with the placed tiles marked. Cross-checks are computed once.
+         * @param board Position before the moves
+         * @param moves Array of `count` moves (tiles resolved, see resolveTiles)
+         * @param count Batch size
+         * @param out Buffer of count * ENCODER_SAMPLE_SIZE values
+         */
+        void encodeMoves(const Board& board, const Move* moves, size_t count, float* out) const;
+        void encodeMoves(const Board& board, const Move* moves, size_t count, uint8_t* out) const;
+    };
+
+}
+
+#endif // ENCODER_H
@@ -1,33 +1,97 @@
 #include "Gaddag.h"
 #include <cstdint>
+#include <atomic>
 
 namespace Scrabble {
 
-    Node::~Node() {
-        for (auto& pair : children) {
-            delete pair.second;
-        }
-    }
-
     Gaddag::Gaddag() {
-        root = new Node(0); // Root node
+        root = Node::create(0, arena); // Root node
+        touch();
     }
 
     Gaddag::~Gaddag() {
-        delete root;
+        // The arena frees every node with its blocks: no walk over the graph
+    }
+
+    void Gaddag::clear() {
+        arena.release();
+        root = Node::create(0, arena);
+        touch();
+    }
+
+    void Gaddag::touch() {
+        static std::atomic<uint64_t> revisions(0);
+        revision = ++revisions;
     }
 
     void Gaddag::insertPath(const std::string& path) {
         Node* current = root;
         for (char c : path) {
             if (current->children.find(c) == current->children.end()) {
-                current->children[c] = new Node(c);
+                current->children[c] = Node::create(c, arena);
             }
             current = current->children[c];
         }
         current->isTerminal = true;
     }
 
+    void Gaddag::removePath(const std::string& path) {
+        std::vector<Node*> nodes(1, root);
+        for (char c : path) {
+            auto child = nodes.back()->children.find(c);
+            if (child == nodes.back()->children.end()) return;
+            nodes.push_back(child->second);
+        }
+        nodes.back()->isTerminal = false;
+
+        // Walk back up while the node leads nowhere: no other path goes through it
+        for (size_t i = nodes.size() - 1; i > 0; --i) {
+            Node* node = nodes[i];
+            if (node->isTerminal || !node->children.empty()) break;
+            nodes[i - 1]->children.erase(path[i - 1]);  // Its memory stays in the arena until clear()
+        }
+    }
+
+    std::string Gaddag::normalizeWord(const std::string& word) {
+        std::string out = word;
+        out.erase(std::remove_if(out.begin(), out.end(), ::isspace), out.end());
+        std::transform(out.begin(), out.end(), out.begin(), ::toupper);
+        return out;
+    }
+
+    void Gaddag::insertWord(const std::string& word) {
+        // REV(prefix) + suffix for every non-empty prefix (see loadFromFile)
+        for (size_t j = 1; j <= word.length(); ++j) {
+            std::string path = word.substr(0, j);
+            std::reverse(path.begin(), path.end());
+            path += GADDAG_DELIMITER;
+            path += word.substr(j);
+            insertPath(path);
+        }
+    }
+
+    bool Gaddag::addWord(const std::string& word) {
+        std::string normalized = normalizeWord(word);
+        if (normalized.empty() || contains(normalized)) return false;
+        insertWord(normalized);
+        touch();
+        return true;
+    }
+
+    bool Gaddag::removeWord(const std::string& word) {
+        std::string normalized = normalizeWord(word);
+        if (normalized.empty() || !contains(normalized)) return false;
+        for (size_t j = 1; j <= normalized.length(); ++j) {
+            std::string path = normalized.substr(0, j);
+            std::reverse(path.begin(), path.end());
+            path += GADDAG_DELIMITER;
+            path += normalized.substr(j);
+            removePath(path);
+        }
+        touch();
+        return true;
+    }
+
     bool Gaddag::loadFromFile(const std::string& filePath) {
         std::ifstream file(filePath);
         if (!file.is_open()) {
@@ -37,14 +101,10 @@ namespace Scrabble {
 
         std::string word;
         while (std::getline(file, word)) {
-            // Remove any carriage returns or whitespace
-            word.erase(std::remove_if(word.begin(), word.end(), ::isspace), word.end());
-            
+            // Remove any carriage returns or whitespace, convert to uppercase
+            word = normalizeWord(word);
             if (word.empty()) continue;
 
-            // Convert to uppercase if needed (assuming standard is uppercase)
-            std::transform(word.begin(), word.end(), word.begin(), ::toupper);
-
             // Generate GADDAG paths
             // Gordon's Algorithm:
             // For word w_1...w_n, add paths:
@@ -67,20 +127,11 @@ namespace Scrabble {
             // Prefix "CAR", Suffix "E" -> "RAC+E"
             // Prefix "CARE", Suffix "" -> "ERAC+"
             
-            for (size_t j = 1; j <= word.length(); ++j) {
-                std::string prefix = word.substr(0, j);
-                std::string suffix = (j < word.length()) ? word.substr(j) : "";
-                
-                std::string path = prefix;
-                std::reverse(path.begin(), path.end());
-                path += GADDAG_DELIMITER;
-                path += suffix;
-                
-                insertPath(path);
-            }
+            insertWord(word);
         }
         
         file.close();
+        touch();
         std::cout << "GADDAG Loaded successfully." << std::endl;
         return true;
     }
@@ -88,15 +139,15 @@ namespace Scrabble {
 
     // --- Binary Serialization Helpers ---
 
-    void saveNode(Node* node, std::ofstream& out) {
+    void saveNode(const Node* node, std::ofstream& out) {
         // Format: [char letter] [bool isTerminal] [uint8_t numChildren] [Children...]
         out.write(&node->letter, sizeof(char));
-        out.write(reinterpret_cast<char*>(&node->isTerminal), sizeof(bool));
+        out.write(reinterpret_cast<const char*>(&node->isTerminal), sizeof(bool));
         
         uint8_t numChildren = (uint8_t)node->children.size();
         out.write(reinterpret_cast<char*>(&numChildren), sizeof(uint8_t));
 
-        for (auto& pair : node->children) {
+        for (const auto& pair : node->children) {
             // Write Child Key (Char)
             out.write(&pair.first, sizeof(char));
             // Recursively write child node
@@ -104,7 +155,7 @@ namespace Scrabble {
         }
     }
 
-    Node* loadNode(std::ifstream& in) {
+    Node* loadNode(std::ifstream& in, NodeArena& arena) {
         char letter;
         bool isTerminal;
         uint8_t numChildren;
@@ -115,13 +166,13 @@ namespace Scrabble {
 
         if (in.fail()) return nullptr;
 
-        Node* node = new Node(letter);
+        Node* node = Node::create(letter, arena);
         node->isTerminal = isTerminal;
 
         for (int i = 0; i < numChildren; ++i) {
             char key;
             in.read(&key, sizeof(char));
-            Node* child = loadNode(in);
+            Node* child = loadNode(in, arena);
             if (child) {
                 node->children[key] = child;
             }
@@ -152,19 +203,34 @@ namespace Scrabble {
             return false;
         }
 
-        // Clean up existing
-        delete root;
+        // Clean up existing: one release of the arena
+        arena.release();
         
-        root = loadNode(file);
+        root = loadNode(file, arena);
         
         file.close();
         if (root) {
+            touch();
             std::cout << "GADDAG Loaded from binary." << std::endl;
             return true;
         }
+        clear(); // Keep a valid (empty) dictionary after a failed load
         return false;
     }
 
+    bool Gaddag::loadCached(const std::string& textPath, const std::string& binaryPath) {
+        std::ifstream binFile(binaryPath);
+        if (binFile.good()) {
+            binFile.close();
+            if (loadBinary(binaryPath)) return true;
+            std::cerr << "Failed to load binary. Falling back to text." << std::endl;
+        }
+
+        if (!loadFromFile(textPath)) return false;
+        saveBinary(binaryPath);
+        return true;
+    }
+
     bool Gaddag::contains(const std::string& word) const {
         // Normalize to uppercase
         std::string upperWord = word;
@@ -176,12 +242,13 @@ namespace Scrabble {
         std::reverse(checkPath.begin(), checkPath.end());
         checkPath += GADDAG_DELIMITER;
         
-        Node* current = root;
+        const Node* current = root;
         for (char c : checkPath) {
-            if (current->children.find(c) == current->children.end()) {
+            auto child = current->children.find(c);
+            if (child == current->children.end()) {
                 return false;
             }
-            current = current->children[c];
+            current = child->second;
         }
         return current->isTerminal;
     }
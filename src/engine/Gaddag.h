@@ -7,29 +7,126 @@
 #include <fstream>
 #include <iostream>
 #include <algorithm>
+#include <memory>
+#include <cstdint>
+#include <new>
 
 namespace Scrabble {
 
     // Separator character for GADDAG paths
     const char GADDAG_DELIMITER = '+';
 
+    /**
+     * Bump allocator for a graph's nodes and their child maps. Blocks are
+     * allocated back to back and freed together: a dictionary is released in
+     * one pass over its blocks instead of a walk over every node. Memory of
+     * erased nodes and of outgrown hash tables is only reclaimed by release().
+     */
+    class NodeArena {
+    private:
+        static const size_t BLOCK_BYTES = 1 << 20;
+
+        std::vector<std::unique_ptr<char[]>> blocks;
+        size_t used;        // Bytes taken in the last block
+        size_t capacity;    // Size of the last block
+        size_t total;       // Bytes in all blocks
+
+    public:
+        NodeArena() : used(0), capacity(0), total(0) {}
+
+        NodeArena(const NodeArena&) = delete;
+        NodeArena& operator=(const NodeArena&) = delete;
+
+        void* allocate(size_t bytes, size_t alignment) {
+            size_t start = (used + alignment - 1) & ~(alignment - 1);
+            if (start + bytes > capacity) {
+                // Oversized requests get a block of their own
+                capacity = std::max(bytes, (size_t)BLOCK_BYTES);
+                blocks.emplace_back(new char[capacity]);
+                total += capacity;
+                start = 0;
+            }
+            used = start + bytes;
+            return blocks.back().get() + start;
+        }
+
+        // Free every block at once (objects in the arena are not destroyed)
+        void release() {
+            blocks.clear();
+            used = capacity = total = 0;
+        }
+
+        size_t bytes() const { return total; }
+    };
+
+    // Standard allocator over a NodeArena; deallocation is a no-op
+    template <typename T>
+    struct ArenaAllocator {
+        using value_type = T;
+        NodeArena* arena;
+
+        explicit ArenaAllocator(NodeArena& a) : arena(&a) {}
+        template <typename U>
+        ArenaAllocator(const ArenaAllocator<U>& other) : arena(other.arena) {}
+
+        T* allocate(size_t n) { return static_cast<T*>(arena->allocate(n * sizeof(T), alignof(T))); }
+        void deallocate(T*, size_t) {}
+
+        template <typename U>
+        bool operator==(const ArenaAllocator<U>& other) const { return arena == other.arena; }
+        template <typename U>
+        bool operator!=(const ArenaAllocator<U>& other) const { return arena != other.arena; }
+    };
+
     struct Node {
+        using Children = std::unordered_map<char, Node*, std::hash<char>, std::equal_to<char>,
+                                            ArenaAllocator<std::pair<const char, Node*>>>;
+
         char letter;
         bool isTerminal; // True if this node marks the end of a valid word (in a GADDAG path sense)
-        std::unordered_map<char, Node*> children;
+        Children children;
+
+        // Nodes live in an arena (see create) and are never destroyed one by one
+        Node(char c, NodeArena& arena)
+            : letter(c), isTerminal(false), children(Children::allocator_type(arena)) {}
 
-        Node(char c) : letter(c), isTerminal(false) {}
-        ~Node();
+        static Node* create(char c, NodeArena& arena) {
+            return new (arena.allocate(sizeof(Node), alignof(Node))) Node(c, arena);
+        }
     };
 
+    // Binary node format shared by Gaddag::saveBinary/loadBinary and LazyGaddag:
+    // [char letter] [bool isTerminal] [uint8_t numChildren] then, per child, [char key] [child node]
+    void saveNode(const Node* node, std::ofstream& out);
+
+    // Read one node and its subtree into an arena; nullptr on a read error
+    Node* loadNode(std::ifstream& in, NodeArena& arena);
+
     class Gaddag {
     private:
+        NodeArena arena;    // Every node of the graph
         Node* root;
+        uint64_t revision;  // Changes with every update of the graph (see getRevision)
+
+        // Give the graph a new revision, never used by any Gaddag before
+        void touch();
+
+        // Drop the graph (one release of the arena) and start from an empty root
+        void clear();
+
+        // Assembles the graph from subtrees it has loaded itself
+        friend class LazyGaddag;
 
         // Helper to insert a single GADDAG path
         // e.g., for word "CARE", insert "C+ARE", "A C+RE", "R A C+E", "E R A C+"
         void insertPath(const std::string& path);
 
+        // Clear the end of a path and unlink the nodes no other path uses
+        void removePath(const std::string& path);
+
+        // Insert every path of a normalized word
+        void insertWord(const std::string& word);
+
     public:
         Gaddag();
         ~Gaddag();
@@ -38,14 +135,55 @@ namespace Scrabble {
         // Load dictionary from a file (one word per line)
         bool loadFromFile(const std::string& filePath);
 
+        // Word as stored: whitespace removed, upper case (as loadFromFile reads it)
+        static std::string normalizeWord(const std::string& word);
+
+        // Add a word in place; false if it was already there (or is empty).
+        // Not safe while other threads read the dictionary.
+        bool addWord(const std::string& word);
+
+        // Remove a word in place, pruning the branches only it used; false if it was not there.
+        // Not safe while other threads read the dictionary.
+        bool removeWord(const std::string& word);
+
         // Save GADDAG to a binary file for faster loading
         bool saveBinary(const std::string& filePath);
         
         // Load GADDAG from a binary file
         bool loadBinary(const std::string& filePath);
 
-        // Check if the exact path exists (mostly for debugging/verification)
-        Node* getRoot() const { return root; }
+        // Load the binary GADDAG if present, otherwise build from the word list and save the binary
+        bool loadCached(const std::string& textPath, const std::string& binaryPath);
+
+        // Root of the graph, read-only: once loaded, the GADDAG is immutable and can be
+        // read by any number of threads at once (lookups must use find(), never operator[])
+        const Node* getRoot() const { return root; }
+
+        // Stamp of the graph's current contents: loads, addWord and removeWord change it, and no
+        // two graphs share one, so caches keyed on a dictionary can tell when to drop their entries
+        uint64_t getRevision() const { return revision; }
+
+        // Memory held by the graph (arena blocks), in bytes
+        size_t bytes() const { return arena.bytes(); }
+
+        // Traversal interface, shared with SuccinctGaddag so that MoveGenerator runs on either
+        using Cursor = const Node*;
+        Cursor rootCursor() const { return root; }
+        static bool isTerminal(Cursor node) { return node->isTerminal; }
+
+        // Follow the edge labelled letter; false if there is none
+        static bool child(Cursor node, char letter, Cursor& next) {
+            auto it = node->children.find(letter);
+            if (it == node->children.end()) return false;
+            next = it->second;
+            return true;
+        }
+
+        // Calls f(letter, child) for each outgoing edge
+        template <typename F>
+        static void forEachChild(Cursor node, F f) {
+            for (const auto& edge : node->children) f(edge.first, (Cursor)edge.second);
+        }
         
         // Debug helper: Check if a word exists (by checking one of its GADDAG paths)
         // Note: In a real GADDAG, we generate moves, we don't usually just "check words" directly like a standard Trie,
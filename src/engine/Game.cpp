@@ -0,0 +1,264 @@
+#include "Game.h"
+#include "Rules.h"
+#include "SuccinctGaddag.h"
+#include "LazyGaddag.h"
+#include "Instrumentation.h"
+#include <algorithm>
+#include <cstdlib>
+
+namespace Scrabble {
+
+    Game::Game(uint64_t seed) : bag(seed), toMove(0), turn(0), scorelessTurns(0), over(false) {
+        for (int p = 0; p < NUM_PLAYERS; ++p) {
+            scores[p] = 0;
+            bag.refill(racks[p], RACK_SIZE);
+        }
+    }
+
+    // Merges the vertical pass (generated on the transposed board) into the horizontal moves,
+    // then deduplicates and scores. With a mask, both passes only hold moves touching it.
+    static std::vector<Move> mergeScoredMoves(const Board& board, const std::vector<char>& rack,
+                                              std::vector<Move> moves, std::vector<Move>& vertical,
+                                              const SquareMask* mask, bool keepSingles = false) {
+        for (Move& m : vertical) {
+            std::swap(m.row, m.col);
+            m.horizontal = false;
+
+            // A single tile that also forms a horizontal word was already found by the horizontal pass
+            if (m.tileCount == 1) {
+                int r = m.row;
+                while (!board.isEmpty(r, m.col)) r++;
+                if (!board.getTile(r, m.col - 1).isEmpty() || !board.getTile(r, m.col + 1).isEmpty()) {
+                    int first = m.col, last = m.col;
+                    while (!board.getTile(r, first - 1).isEmpty()) first--;
+                    while (!board.getTile(r, last + 1).isEmpty()) last++;
+                    if (!keepSingles && (!mask || mask->touches(r, first, last))) continue;
+
+                    // Only its vertical word reaches the mask (or the horizontal pass may have
+                    // stopped before it): keep it, in its horizontal form
+                    Move h = m;
+                    h.row = r;
+                    h.col = first;
+                    h.horizontal = true;
+                    h.word.clear();
+                    for (int c = first; c <= last; ++c) {
+                        h.word += c == m.col ? m.tiles[0].letter : board.getTile(r, c).letter;
+                    }
+                    moves.push_back(h);
+                    continue;
+                }
+            }
+            moves.push_back(m);
+        }
+
+        // The generator reaches the same move from several anchors
+        {
+            SCRABBLE_STAGE_TIMER(StageDedup);
+            std::sort(moves.begin(), moves.end(), [](const Move& a, const Move& b) {
+                if (a.row != b.row) return a.row < b.row;
+                if (a.col != b.col) return a.col < b.col;
+                if (a.horizontal != b.horizontal) return a.horizontal < b.horizontal;
+                return a.word < b.word;
+            });
+            auto last = std::unique(moves.begin(), moves.end(), [](const Move& a, const Move& b) {
+                return a.row == b.row && a.col == b.col &&
+                       a.horizontal == b.horizontal && a.word == b.word;
+            });
+            SCRABBLE_COUNT(duplicates, moves.end() - last);
+            moves.erase(last, moves.end());
+        }
+
+        SCRABBLE_STAGE_TIMER(StageScoring);
+        for (Move& m : moves) {
+            resolveAndScore(board, m, rack);
+        }
+        return moves;
+    }
+
+    std::vector<Move> generateScoredMoves(const Board& board, const std::vector<char>& rack,
+                                          const MoveGenerator& generator, const Gaddag& gaddag) {
+        std::vector<Move> moves = generator.generateMoves(board, rack, gaddag);
+
+        // Vertical moves: generate horizontally on the transposed board and map back
+        std::vector<Move> vertical = generator.generateMoves(board.transposed(), rack, gaddag);
+        return mergeScoredMoves(board, rack, std::move(moves), vertical, nullptr);
+    }
+
+    std::vector<Move> generateScoredMoves(const Board& board, const std::vector<char>& rack,
+                                          const MoveGenerator& generator, const Gaddag& gaddag,
+                                          const SquareMask& mask) {
+        std::vector<Move> moves = generator.generateMoves(board, rack, gaddag, mask);
+        std::vector<Move> vertical = generator.generateMoves(board.transposed(), rack, gaddag, mask.transposed());
+        return mergeScoredMoves(board, rack, std::move(moves), vertical, &mask);
+    }
+
+    std::vector<Move> generateScoredMoves(const Board& board, const std::vector<char>& rack,
+                                          const MoveGenerator& generator, const Gaddag& gaddag,
+                                          GenContext& context) {
+        std::vector<Move> moves = generator.generateMoves(board, rack, gaddag, context);
+        generator.generateMoves(board.transposed(), rack, gaddag, context);
+        return mergeScoredMoves(board, rack, std::move(moves), context.moves, nullptr);
+    }
+
+    std::vector<Move> generateScoredMoves(const Board& board, const std::vector<char>& rack,
+                                          const MoveGenerator& generator, const SuccinctGaddag& dictionary,
+                                          GenContext& context) {
+        std::vector<Move> moves = generator.generateMoves(board, rack, dictionary, context);
+        generator.generateMoves(board.transposed(), rack, dictionary, context);
+        return mergeScoredMoves(board, rack, std::move(moves), context.moves, nullptr);
+    }
+
+    std::vector<Move> generateScoredMoves(const Board& board, const std::vector<char>& rack,
+                                          const MoveGenerator& generator, const LazyGaddag& dictionary,
+                                          GenContext& context) {
+        std::vector<Move> moves = generator.generateMoves(board, rack, dictionary, context);
+        generator.generateMoves(board.transposed(), rack, dictionary, context);
+        return mergeScoredMoves(board, rack, std::move(moves), context.moves, nullptr);
+    }
+
+    std::vector<Move> generateScoredMoves(const Board& board, const std::vector<char>& rack,
+                                          const MoveGenerator& generator, const Gaddag& gaddag,
+                                          MoveCache& cache) {
+        std::vector<Move> moves = cache.generateMoves(board, rack, generator, gaddag);
+        std::vector<Move> vertical = cache.generateMoves(board.transposed(), rack, generator, gaddag);
+        return mergeScoredMoves(board, rack, std::move(moves), vertical, nullptr);
+    }
+
+    // Rough payoff of playing through an anchor: premium squares and hooks within
+    // reach of the rack, weighted by their distance, and tiles already on the line
+    static int anchorPayoff(const Board& board, const uint32_t crossChecks[15][15], int row, int col, int tiles) {
+        static const int BONUS_WEIGHT[] = {0, 2, 4, 6, 10};
+        int payoff = 0;
+        for (int c = std::max(0, col - tiles + 1); c <= std::min(14, col + tiles - 1); ++c) {
+            int weight = tiles - std::abs(c - col);
+            if (!board.isEmpty(row, c)) {
+                payoff += weight * letterValue(board.getTile(row, c).letter);
+                continue;
+            }
+            payoff += weight * BONUS_WEIGHT[(int)board.getBonus(row, c)];
+            if (crossChecks[row][c] != 0x3FFFFFF && crossChecks[row][c] != 0) payoff += 3 * weight;
+        }
+        return payoff;
+    }
+
+    MoveSearchResult searchScoredMoves(const Board& board, const std::vector<char>& rack,
+                                       const MoveGenerator& generator, const Gaddag& gaddag,
+                                       SearchBudget& budget) {
+        // Direction 0 is the board itself, direction 1 its transpose (vertical moves)
+        Board boards[2] = {board, board.transposed()};
+        uint32_t crossChecks[2][15][15];
+        int anchors[2][225];
+        int anchorCount[2];
+        for (int d = 0; d < 2; ++d) {
+            generator.computeCrossChecks(boards[d], gaddag, crossChecks[d]);
+            anchorCount[d] = generator.findAnchors(boards[d], anchors[d]);
+        }
+
+        struct Candidate {
+            int payoff;
+            int direction;
+            int anchor;
+        };
+        std::vector<Candidate> order;
+        int tiles = std::min<int>((int)rack.size(), 15);
+        for (int d = 0; d < 2; ++d) {
+            for (int i = 0; i < anchorCount[d]; ++i) {
+                int a = anchors[d][i];
+                order.push_back({anchorPayoff(boards[d], crossChecks[d], a / 15, a % 15, tiles), d, a});
+            }
+        }
+        std::stable_sort(order.begin(), order.end(), [](const Candidate& a, const Candidate& b) {
+            return a.payoff > b.payoff;
+        });
+
+        MoveSearchResult result;
+        result.anchorsTotal = (int)order.size();
+        std::vector<Move> found[2];
+        for (const Candidate& c : order) {
+            if (generator.generateFromAnchors(boards[c.direction], rack, gaddag, crossChecks[c.direction],
+                                              &c.anchor, 1, found[c.direction], budget) == 0) {
+                break;
+            }
+            result.anchorsSearched++;
+        }
+        result.complete = result.anchorsSearched == result.anchorsTotal;
+        result.moves = mergeScoredMoves(board, rack, std::move(found[0]), found[1], nullptr, !result.complete);
+        return result;
+    }
+
+    std::vector<Move> Game::legalMoves(const MoveGenerator& generator, const Gaddag& gaddag) const {
+        return generateScoredMoves(board, racks[toMove], generator, gaddag);
+    }
+
+    std::vector<Move> Game::legalMoves(const MoveGenerator& generator, const Gaddag& gaddag, MoveCache& cache) const {
+        return generateScoredMoves(board, racks[toMove], generator, gaddag, cache);
+    }
+
+    bool Game::play(const Move& move) {
+        if (over || move.tileCount <= 0) return false;
+
+        std::vector<char> rack = racks[toMove];
+        for (int i = 0; i < move.tileCount; ++i) {
+            const Tile& t = move.tiles[i];
+            auto it = t.isBlank()
+                ? std::find_if(rack.begin(), rack.end(), isBlankTile)
+                : std::find(rack.begin(), rack.end(), t.letter);
+            if (it == rack.end()) return false;
+            rack.erase(it);
+        }
+
+        scores[toMove] += scoreMove(board, move);
+        applyMove(board, move);
+        bag.refill(rack, RACK_SIZE);
+        racks[toMove] = rack;
+
+        if (rack.empty() && bag.empty()) {
+            finish(toMove);
+            return true;
+        }
+        endTurn(true);
+        return true;
+    }
+
+    bool Game::exchange(const std::vector<char>& toExchange) {
+        if (over || !bag.exchange(racks[toMove], toExchange)) return false;
+        endTurn(false);
+        return true;
+    }
+
+    void Game::pass() {
+        if (over) return;
+        endTurn(false);
+    }
+
+    void Game::endTurn(bool scored) {
+        scorelessTurns = scored ? 0 : scorelessTurns + 1;
+        turn++;
+        toMove = (toMove + 1) % NUM_PLAYERS;
+        if (scorelessTurns >= MAX_SCORELESS_TURNS) {
+            finish(-1);
+        }
+    }
+
+    void Game::finish(int playerOut) {
+        int leftover[NUM_PLAYERS];
+        int totalLeftover = 0;
+        for (int p = 0; p < NUM_PLAYERS; ++p) {
+            leftover[p] = 0;
+            for (char c : racks[p]) leftover[p] += letterValue(c);
+            totalLeftover += leftover[p];
+        }
+
+        // Everyone loses the value of their remaining tiles; the player who went out collects it
+        for (int p = 0; p < NUM_PLAYERS; ++p) {
+            scores[p] -= leftover[p];
+        }
+        if (playerOut >= 0) {
+            scores[playerOut] += totalLeftover;
+        }
+
+        turn++;
+        over = true;
+    }
+
+}
@@ -0,0 +1,169 @@
+#ifndef GAME_H
+#define GAME_H
+
+#include "engine.h"
+#include "Gaddag.h"
+#include "MoveGenerator.h"
+#include "MoveCache.h"
+#include "TileBag.h"
+#include <vector>
+#include <cstdint>
+
+namespace Scrabble {
+
+    /**
+     * Generate every legal placement for a rack, in both directions.
+     * Moves are deduplicated, have their rack tiles resolved (blanks have value 0)
+     * and carry their real score.
+     * @param board The current game board
+     * @param rack The rack to play from
+     * @param generator Move generator
+     * @param gaddag Dictionary
+     * @return Scored legal moves (empty if nothing can be placed)
+     */
+    std::vector<Move> generateScoredMoves(const Board& board, const std::vector<char>& rack,
+                                          const MoveGenerator& generator, const Gaddag& gaddag);
+
+    /**
+     * Same, restricted to the moves whose word covers a square of a mask
+     * (for a single tile, either of the words it forms). Returns the subset of
+     * the unrestricted result, at a fraction of its cost for small masks.
+     * @param mask Squares to play through
+     */
+    std::vector<Move> generateScoredMoves(const Board& board, const std::vector<char>& rack,
+                                          const MoveGenerator& generator, const Gaddag& gaddag,
+                                          const SquareMask& mask);
+
+    /**
+     * Same as the unrestricted version, with the generator's scratch memory
+     * taken from a per-thread context instead of allocated per call.
+     * @param context Scratch of the calling thread
+     */
+    std::vector<Move> generateScoredMoves(const Board& board, const std::vector<char>& rack,
+                                          const MoveGenerator& generator, const Gaddag& gaddag,
+                                          GenContext& context);
+
+    /**
+     * Same, from a succinct GADDAG (see SuccinctGaddag). The result is identical
+     * to generation from the pointer GADDAG of the same lexicon.
+     * @param dictionary Succinct dictionary
+     * @param context Scratch of the calling thread
+     */
+    std::vector<Move> generateScoredMoves(const Board& board, const std::vector<char>& rack,
+                                          const MoveGenerator& generator, const SuccinctGaddag& dictionary,
+                                          GenContext& context);
+
+    /**
+     * Same, from a dictionary that may still be loading (see LazyGaddag). Only the
+     * pages this position needs are waited for.
+     * @param dictionary Paged dictionary
+     * @param context Scratch of the calling thread
+     */
+    std::vector<Move> generateScoredMoves(const Board& board, const std::vector<char>& rack,
+                                          const MoveGenerator& generator, const LazyGaddag& dictionary,
+                                          GenContext& context);
+
+    /**
+     * Same as the unrestricted version, reusing the lines a cache has already
+     * generated (see MoveCache). The result is identical.
+     * @param cache Line cache, owned by the calling thread
+     */
+    std::vector<Move> generateScoredMoves(const Board& board, const std::vector<char>& rack,
+                                          const MoveGenerator& generator, const Gaddag& gaddag,
+                                          MoveCache& cache);
+
+    struct MoveSearchResult {
+        std::vector<Move> moves;    // Scored, deduplicated moves found (all legal)
+        bool complete = false;      // Every anchor was searched: moves is the full list
+        int anchorsSearched = 0;    // Anchors traversed to the end, both directions
+        int anchorsTotal = 0;
+    };
+
+    /**
+     * Anytime version of generateScoredMoves for latency-bound callers.
+     * Anchors of both directions are searched most promising first (premium
+     * squares within reach, hooks, tiles to play through) until the budget runs
+     * out; the moves found so far are returned, scored, with a completeness flag.
+     * Cross-checks and anchors are always computed in full.
+     * @param budget Deadline and/or node limit, charged during the search
+     * @return Moves found and whether the search completed
+     */
+    MoveSearchResult searchScoredMoves(const Board& board, const std::vector<char>& rack,
+                                       const MoveGenerator& generator, const Gaddag& gaddag,
+                                       SearchBudget& budget);
+
+    /**
+     * Full state of a two-player game: board, bag, racks, scores and turn order.
+     * Enforces turn sequencing and end-of-game rules; move selection is left to the caller.
+     */
+    class Game {
+    public:
+        static const int NUM_PLAYERS = 2;
+
+    private:
+        Board board;
+        TileBag bag;
+        std::vector<char> racks[NUM_PLAYERS];
+        int scores[NUM_PLAYERS];
+        int toMove;
+        int turn;
+        int scorelessTurns;
+        bool over;
+
+        // Advance to the next player and apply end-of-game conditions
+        void endTurn(bool scored);
+
+        // Apply end-of-game rack penalties. playerOut is -1 when nobody went out.
+        void finish(int playerOut);
+
+    public:
+        /**
+         * Start a new game: fresh board, full bag, both racks drawn.
+         * @param seed Seed for the tile bag (same seed = same draws)
+         */
+        explicit Game(uint64_t seed);
+
+        const Board& getBoard() const { return board; }
+        const std::vector<char>& getRack(int player) const { return racks[player]; }
+        int getScore(int player) const { return scores[player]; }
+        int currentPlayer() const { return toMove; }
+        int turnNumber() const { return turn; }
+        size_t bagSize() const { return bag.size(); }
+        bool isOver() const { return over; }
+
+        /**
+         * Generate every legal placement for the player to move (see generateScoredMoves).
+         * @param generator Move generator
+         * @param gaddag Dictionary
+         * @return Scored legal moves (empty if the player cannot place anything)
+         */
+        std::vector<Move> legalMoves(const MoveGenerator& generator, const Gaddag& gaddag) const;
+
+        /**
+         * Same, through a line cache kept across turns.
+         */
+        std::vector<Move> legalMoves(const MoveGenerator& generator, const Gaddag& gaddag, MoveCache& cache) const;
+
+        /**
+         * Play a move returned by legalMoves for the current player.
+         * @param move The move to play
+         * @return false if the move cannot be supplied by the current rack
+         */
+        bool play(const Move& move);
+
+        /**
+         * Exchange tiles from the current player's rack.
+         * @param toExchange Tiles to return to the bag
+         * @return false if the exchange is illegal (bag too small, tiles missing)
+         */
+        bool exchange(const std::vector<char>& toExchange);
+
+        /**
+         * Pass the turn.
+         */
+        void pass();
+    };
+
+}
+
+#endif // GAME_H
@@ -0,0 +1,80 @@
+#include "Instrumentation.h"
+#include <mutex>
+
+namespace Scrabble {
+
+    static std::mutex retiredMutex;
+    static GenCounters retired;
+
+    // Folds a thread's counters into the global sum when the thread exits
+    struct ThreadCounters {
+        GenCounters counters;
+        ~ThreadCounters() {
+            std::lock_guard<std::mutex> lock(retiredMutex);
+            retired.add(counters);
+        }
+    };
+
+    static thread_local ThreadCounters local;
+
+    void GenCounters::add(const GenCounters& other) {
+        nodesVisited += other.nodesVisited;
+        arcsTried += other.arcsTried;
+        crossCheckRejects += other.crossCheckRejects;
+        rackAttempts += other.rackAttempts;
+        blankExpansions += other.blankExpansions;
+        delimiterTransitions += other.delimiterTransitions;
+        movesRecorded += other.movesRecorded;
+        duplicates += other.duplicates;
+        for (int i = 0; i < StageCount; ++i) {
+            ticks[i] += other.ticks[i];
+            calls[i] += other.calls[i];
+        }
+    }
+
+    GenCounters& threadCounters() {
+        return local.counters;
+    }
+
+    GenCounters collectCounters() {
+        GenCounters total;
+        {
+            std::lock_guard<std::mutex> lock(retiredMutex);
+            total = retired;
+        }
+        total.add(local.counters);
+        return total;
+    }
+
+    void resetCounters() {
+        std::lock_guard<std::mutex> lock(retiredMutex);
+        retired = GenCounters();
+        local.counters = GenCounters();
+    }
+
+    const char* stageName(int stage) {
+        switch (stage) {
+            case StageCrossChecks: return "cross_checks";
+            case StageAnchors: return "anchors";
+            case StageTraversal: return "traversal";
+            case StageDedup: return "dedup";
+            case StageScoring: return "scoring";
+            default: return "unknown";
+        }
+    }
+
+    void printCounters(std::ostream& out, const GenCounters& c) {
+        out << "Nodes visited:          " << c.nodesVisited << "\n"
+            << "Arcs tried:             " << c.arcsTried << "\n"
+            << "Cross-check rejects:    " << c.crossCheckRejects << "\n"
+            << "Rack attempts:          " << c.rackAttempts << "\n"
+            << "Blank expansions:       " << c.blankExpansions << "\n"
+            << "Delimiter transitions:  " << c.delimiterTransitions << "\n"
+            << "Moves recorded:         " << c.movesRecorded << "\n"
+            << "Duplicates:             " << c.duplicates << "\n";
+        for (int i = 0; i < StageCount; ++i) {
+            out << "Stage " << stageName(i) << ": " << c.ticks[i] << " ticks in " << c.calls[i] << " calls\n";
+        }
+    }
+
+}
@@ -0,0 +1,113 @@
+#ifndef INSTRUMENTATION_H
+#define INSTRUMENTATION_H
+
+#include <cstdint>
+#include <ostream>
+#include <chrono>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+namespace Scrabble {
+
+    /*
+     * Hot-path counters and stage timers for move generation.
+     *
+     * Compiled in only when SCRABBLE_INSTRUMENT is defined (CMake option
+     * SCRABBLE_INSTRUMENT=ON); otherwise the macros below expand to nothing and
+     * the generator is unchanged. Counters are accumulated per thread without
+     * synchronisation; a thread's totals are folded into a global sum when it exits.
+     */
+
+#ifdef SCRABBLE_INSTRUMENT
+    const bool INSTRUMENTATION_ENABLED = true;
+#else
+    const bool INSTRUMENTATION_ENABLED = false;
+#endif
+
+    enum GenStage {
+        StageCrossChecks = 0,
+        StageAnchors,
+        StageTraversal,
+        StageDedup,
+        StageScoring,
+        StageCount
+    };
+
+    struct GenCounters {
+        uint64_t nodesVisited = 0;          // GADDAG nodes entered by genLeft/gen
+        uint64_t arcsTried = 0;             // Child lookups for a candidate letter
+        uint64_t crossCheckRejects = 0;     // Arcs that exist but fail the cross-check
+        uint64_t rackAttempts = 0;          // Rack tiles tried on an empty square
+        uint64_t blankExpansions = 0;       // Blanks expanded to A..Z
+        uint64_t delimiterTransitions = 0;  // Switches from the left part to the right part
+        uint64_t movesRecorded = 0;         // Moves appended by the traversal
+        uint64_t duplicates = 0;            // Moves dropped by deduplication
+        uint64_t ticks[StageCount] = {};    // Time per stage (TSC cycles on x86, nanoseconds elsewhere)
+        uint64_t calls[StageCount] = {};    // Timed calls per stage
+
+        void add(const GenCounters& other);
+    };
+
+    /**
+     * Counters of the calling thread.
+     */
+    GenCounters& threadCounters();
+
+    /**
+     * Sum of the counters of exited threads and of the calling thread.
+     * Counters of other running threads are not included.
+     */
+    GenCounters collectCounters();
+
+    /**
+     * Clear the calling thread's counters and the exited-thread sum.
+     */
+    void resetCounters();
+
+    /**
+     * Short name of a stage ("cross_checks", "traversal", ...).
+     */
+    const char* stageName(int stage);
+
+    /**
+     * Print counters as "name: value" lines.
+     */
+    void printCounters(std::ostream& out, const GenCounters& counters);
+
+    // Cycle counter where available, steady clock otherwise
+    inline uint64_t readTicks() {
+#if defined(__x86_64__) || defined(__i386__)
+        return __rdtsc();
+#else
+        return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+    }
+
+    // Adds the lifetime of the scope to a stage
+    class ScopedStageTimer {
+    private:
+        int stage;
+        uint64_t start;
+
+    public:
+        explicit ScopedStageTimer(int stage) : stage(stage), start(readTicks()) {}
+        ~ScopedStageTimer() {
+            GenCounters& c = threadCounters();
+            c.ticks[stage] += readTicks() - start;
+            c.calls[stage]++;
+        }
+    };
+
+}
+
+#ifdef SCRABBLE_INSTRUMENT
+#define SCRABBLE_COUNT(field, n) (::Scrabble::threadCounters().field += (n))
+#define SCRABBLE_STAGE_TIMER(stage) ::Scrabble::ScopedStageTimer scrabbleStageTimer_(stage)
+#else
+#define SCRABBLE_COUNT(field, n) ((void)0)
+#define SCRABBLE_STAGE_TIMER(stage) ((void)0)
+#endif
+
+#endif // INSTRUMENTATION_H
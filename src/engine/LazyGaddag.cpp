@@ -0,0 +1,181 @@
+#include "LazyGaddag.h"
+#include <fstream>
+#include <iostream>
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+
+namespace Scrabble {
+
+    struct LazyHeader {
+        char magic[8];          // "SCRBLZ01"
+        uint32_t pages;
+        uint32_t reserved;
+    };
+
+    struct LazyPage {
+        uint64_t offset;        // From the start of the file
+        uint64_t size;
+        char letter;            // Root edge leading to the subtree
+        char reserved[7];
+    };
+
+    static const char LAZY_MAGIC[8] = {'S', 'C', 'R', 'B', 'L', 'Z', '0', '1'};
+
+    LazyGaddag::LazyGaddag()
+        : root(full.getRoot()), slotCount(0), loaded(0), warm(true), damaged(false) {
+        std::fill(slotOf, slotOf + 256, (int8_t)-1);
+    }
+
+    LazyGaddag::~LazyGaddag() {
+        close();
+    }
+
+    void LazyGaddag::close() {
+        if (prefetcher.joinable()) prefetcher.join();
+        // Pages stay in their slot's arena, even once attached under full's root
+        full.clear();
+        slots.reset();
+        slotCount = 0;
+        std::fill(slotOf, slotOf + 256, (int8_t)-1);
+        root = full.root;
+        loaded.store(0);
+        warm.store(true);
+        damaged.store(false);
+    }
+
+    bool LazyGaddag::savePaged(const Gaddag& gaddag, const std::string& filePath) {
+        std::ofstream out(filePath, std::ios::binary);
+        if (!out.is_open()) {
+            std::cerr << "Error opening file for writing: " << filePath << std::endl;
+            return false;
+        }
+
+        // Pages in letter order, so the table does not depend on hash order
+        std::vector<std::pair<char, const Node*>> edges(gaddag.getRoot()->children.begin(),
+                                                         gaddag.getRoot()->children.end());
+        std::sort(edges.begin(), edges.end(),
+                  [](const std::pair<char, const Node*>& a, const std::pair<char, const Node*>& b) {
+                      return (unsigned char)a.first < (unsigned char)b.first;
+                  });
+
+        LazyHeader header;
+        std::memset(&header, 0, sizeof(header));
+        std::memcpy(header.magic, LAZY_MAGIC, sizeof(header.magic));
+        header.pages = (uint32_t)edges.size();
+        out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+        // Reserve the table, write the pages, then come back to fill it in
+        std::vector<LazyPage> table(edges.size());
+        std::memset(table.data(), 0, table.size() * sizeof(LazyPage));
+        out.write(reinterpret_cast<const char*>(table.data()), (std::streamsize)(table.size() * sizeof(LazyPage)));
+        for (size_t i = 0; i < edges.size(); ++i) {
+            table[i].letter = edges[i].first;
+            table[i].offset = (uint64_t)out.tellp();
+            saveNode(edges[i].second, out);
+            table[i].size = (uint64_t)out.tellp() - table[i].offset;
+        }
+        out.seekp(sizeof(header));
+        out.write(reinterpret_cast<const char*>(table.data()), (std::streamsize)(table.size() * sizeof(LazyPage)));
+        return out.good();
+    }
+
+    bool LazyGaddag::open(const std::string& filePath, bool prefetch) {
+        close();
+        std::ifstream in(filePath, std::ios::binary | std::ios::ate);
+        if (!in.is_open()) {
+            std::cerr << "Error opening file for reading: " << filePath << std::endl;
+            return false;
+        }
+        uint64_t fileSize = (uint64_t)in.tellg();
+        in.seekg(0);
+
+        LazyHeader header;
+        in.read(reinterpret_cast<char*>(&header), sizeof(header));
+        bool ok = in && std::memcmp(header.magic, LAZY_MAGIC, sizeof(header.magic)) == 0 && header.pages <= 256;
+        std::vector<LazyPage> table(ok ? header.pages : 0);
+        if (ok) {
+            in.read(reinterpret_cast<char*>(table.data()), (std::streamsize)(table.size() * sizeof(LazyPage)));
+            ok = (bool)in;
+        }
+        uint64_t dataStart = sizeof(LazyHeader) + table.size() * sizeof(LazyPage);
+        bool seen[256] = {};
+        for (const LazyPage& entry : table) {
+            unsigned char letter = (unsigned char)entry.letter;
+            ok = ok && !seen[letter] && entry.offset >= dataStart && entry.size > 0 && entry.offset <= fileSize &&
+                 entry.size <= fileSize - entry.offset;
+            seen[letter] = true;
+        }
+        if (!ok) {
+            std::cerr << "Malformed paged GADDAG: " << filePath << std::endl;
+            return false;
+        }
+
+        path = filePath;
+        slotCount = (int)table.size();
+        slots.reset(new Slot[slotCount]);
+        for (int i = 0; i < slotCount; ++i) {
+            slots[i].letter = table[i].letter;
+            slots[i].offset = table[i].offset;
+            slots[i].size = table[i].size;
+            slotOf[(unsigned char)table[i].letter] = (int8_t)i;
+        }
+        warm.store(slotCount == 0, std::memory_order_release);
+        if (prefetch && slotCount > 0) prefetcher = std::thread([this]() { warmUp(); });
+        return true;
+    }
+
+    const Node* LazyGaddag::loadPage(int slot) const {
+        Slot& s = slots[slot];
+        std::call_once(s.once, [&]() {
+            // Each load reads through its own stream, so pages can be decoded in parallel
+            std::ifstream in(path, std::ios::binary);
+            in.seekg((std::streamoff)s.offset);
+            Node* node = in ? loadNode(in, s.arena) : nullptr;
+            if (!node || !in || (uint64_t)in.tellg() != s.offset + s.size || node->letter != s.letter) {
+                std::cerr << "Failed to load GADDAG page '" << s.letter << "' from " << path << std::endl;
+                s.arena.release();
+                node = Node::create(s.letter, s.arena);  // Reads as no words below this letter
+                damaged.store(true, std::memory_order_release);
+            }
+            s.node.store(node, std::memory_order_release);
+
+            // The last page completes the graph: hand every page over to full
+            if (loaded.fetch_add(1, std::memory_order_acq_rel) + 1 == slotCount) {
+                for (int i = 0; i < slotCount; ++i) {
+                    full.root->children[slots[i].letter] = slots[i].node.load(std::memory_order_acquire);
+                }
+                full.touch();
+                warm.store(true, std::memory_order_release);
+            }
+        });
+        return s.node.load(std::memory_order_acquire);
+    }
+
+    void LazyGaddag::warmUp() const {
+        for (int i = 0; i < slotCount; ++i) page(i);
+    }
+
+    bool LazyGaddag::contains(const std::string& word) const {
+        // The path REVERSE(WORD) + is terminal exactly for words of the lexicon
+        Cursor node = rootCursor();
+        for (auto it = word.rbegin(); it != word.rend(); ++it) {
+            if (!child(node, (char)std::toupper((unsigned char)*it), node)) return false;
+        }
+        return child(node, GADDAG_DELIMITER, node) && isTerminal(node);
+    }
+
+    bool LazyGaddag::contains(const std::string& word, size_t pivot) const {
+        if (pivot >= word.size()) return contains(word);
+        Cursor node = rootCursor();
+        for (size_t i = pivot + 1; i-- > 0;) {
+            if (!child(node, (char)std::toupper((unsigned char)word[i]), node)) return false;
+        }
+        if (!child(node, GADDAG_DELIMITER, node)) return false;
+        for (size_t i = pivot + 1; i < word.size(); ++i) {
+            if (!child(node, (char)std::toupper((unsigned char)word[i]), node)) return false;
+        }
+        return isTerminal(node);
+    }
+
+}
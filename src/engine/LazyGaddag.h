@@ -0,0 +1,148 @@
+#ifndef LAZY_GADDAG_H
+#define LAZY_GADDAG_H
+
+#include "Gaddag.h"
+#include <string>
+#include <memory>
+#include <mutex>
+#include <atomic>
+#include <thread>
+#include <cstdint>
+
+namespace Scrabble {
+
+    /*
+     * GADDAG loaded page by page, so a process can answer before the whole
+     * dictionary is in memory.
+     *
+     * The paged file splits the graph under the root: one page per root letter,
+     * each the subtree below that edge in the node format of Gaddag::saveBinary.
+     * open() only reads the page table. A page is decoded the first time a
+     * traversal leaves the root through its letter (a blank on the rack, which
+     * walks every root edge, loads them all), and a background thread can
+     * prefetch the others meanwhile. When the last page arrives, the pages are
+     * attached under the root of a complete Gaddag (see gaddag()), and callers
+     * switch to it.
+     *
+     * Offers the traversal interface of Gaddag (Cursor, rootCursor, child,
+     * forEachChild, isTerminal, contains). Lookups and page loads are safe from
+     * any number of threads; open() is not.
+     *
+     * File layout (little-endian): LazyHeader, then one LazyPage entry per page,
+     * then the pages.
+     */
+    class LazyGaddag {
+    public:
+        using Cursor = const Node*;
+
+    private:
+        struct Slot {
+            char letter = 0;
+            uint64_t offset = 0;
+            uint64_t size = 0;
+            std::once_flag once;
+            std::atomic<Node*> node{nullptr};
+            NodeArena arena;                    // The page's nodes, decoded by one thread
+        };
+
+        std::string path;
+        mutable Gaddag full;                    // Receives the pages once all are loaded
+        const Node* root;                       // Root of full: traversals start here
+        std::unique_ptr<Slot[]> slots;
+        int slotCount;
+        int8_t slotOf[256];                     // Page of each root letter, -1 if none
+        mutable std::atomic<int> loaded;
+        mutable std::atomic<bool> warm;
+        mutable std::atomic<bool> damaged;
+        std::thread prefetcher;
+
+        // Decode a page (once) and return its subtree
+        const Node* loadPage(int slot) const;
+
+        const Node* page(int slot) const {
+            Node* node = slots[slot].node.load(std::memory_order_acquire);
+            return node ? node : loadPage(slot);
+        }
+
+        // Stop the prefetch thread and free every page
+        void close();
+
+    public:
+        LazyGaddag();
+        ~LazyGaddag();
+
+        LazyGaddag(const LazyGaddag&) = delete;
+        LazyGaddag& operator=(const LazyGaddag&) = delete;
+
+        /**
+         * Write a loaded GADDAG as a paged file.
+         * @param gaddag Complete dictionary
+         * @param filePath Output file
+         * @return false on I/O error
+         */
+        static bool savePaged(const Gaddag& gaddag, const std::string& filePath);
+
+        /**
+         * Read the page table of a paged file; pages are decoded on first use.
+         * @param filePath File written by savePaged
+         * @param prefetch Load the remaining pages on a background thread
+         * @return false on I/O error or a malformed table (the dictionary is then empty)
+         */
+        bool open(const std::string& filePath, bool prefetch = true);
+
+        /**
+         * Load every page not yet loaded, on the calling thread. Returns once the
+         * dictionary is warm.
+         */
+        void warmUp() const;
+
+        // True once every page is loaded and gaddag() is complete
+        bool isWarm() const { return warm.load(std::memory_order_acquire); }
+
+        // True if a page could not be decoded (it then reads as empty)
+        bool isDamaged() const { return damaged.load(std::memory_order_acquire); }
+
+        int pageCount() const { return slotCount; }
+        int pagesLoaded() const { return loaded.load(std::memory_order_acquire); }
+
+        /**
+         * The complete graph, for code that takes a Gaddag. Only valid once isWarm().
+         */
+        const Gaddag& gaddag() const { return full; }
+
+        // Traversal interface, as in Gaddag
+
+        Cursor rootCursor() const { return root; }
+
+        static bool isTerminal(Cursor node) { return node->isTerminal; }
+
+        bool child(Cursor node, char letter, Cursor& next) const {
+            if (node != root) return Gaddag::child(node, letter, next);
+            int slot = slotOf[(unsigned char)letter];
+            if (slot < 0) return false;
+            next = page(slot);
+            return true;
+        }
+
+        template <typename F>
+        void forEachChild(Cursor node, F f) const {
+            if (node != root) {
+                Gaddag::forEachChild(node, f);
+                return;
+            }
+            for (int i = 0; i < slotCount; ++i) f(slots[i].letter, page(i));
+        }
+
+        bool contains(const std::string& word) const;
+
+        /**
+         * Same, through the path that pivots on word[pivot] (REV(word[0..pivot]) + rest):
+         * only the page of that letter is needed.
+         * @param pivot Index of a letter of word
+         */
+        bool contains(const std::string& word, size_t pivot) const;
+    };
+
+}
+
+#endif // LAZY_GADDAG_H
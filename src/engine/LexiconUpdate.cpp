@@ -0,0 +1,94 @@
+#include "LexiconUpdate.h"
+#include <fstream>
+#include <iostream>
+#include <algorithm>
+#include <set>
+
+namespace Scrabble {
+
+    bool loadDelta(const std::string& filePath, LexiconDelta& delta) {
+        std::ifstream in(filePath);
+        if (!in.is_open()) {
+            std::cerr << "Error opening delta file: " << filePath << std::endl;
+            return false;
+        }
+        delta.clear();
+        std::string line;
+        for (int number = 1; std::getline(in, line); ++number) {
+            std::string edit = Gaddag::normalizeWord(line);
+            if (edit.empty() || edit[0] == '#') continue;
+            std::string word = edit.substr(1);
+            if ((edit[0] != '+' && edit[0] != '-') || word.empty()) {
+                std::cerr << filePath << ":" << number << ": expected +WORD or -WORD" << std::endl;
+                return false;
+            }
+            delta.push_back({edit[0] == '+', word});
+        }
+        return true;
+    }
+
+    bool loadWordList(const std::string& filePath, std::vector<std::string>& words) {
+        std::ifstream in(filePath);
+        if (!in.is_open()) {
+            std::cerr << "Error: Could not open dictionary file: " << filePath << std::endl;
+            return false;
+        }
+        words.clear();
+        std::string line;
+        while (std::getline(in, line)) {
+            std::string word = Gaddag::normalizeWord(line);
+            if (!word.empty()) words.push_back(word);
+        }
+        return true;
+    }
+
+    DeltaStats applyDelta(Gaddag& gaddag, const LexiconDelta& delta) {
+        DeltaStats stats;
+        for (const LexiconEdit& edit : delta) {
+            if (edit.add) {
+                if (gaddag.addWord(edit.word)) stats.added++;
+                else stats.alreadyPresent++;
+            } else {
+                if (gaddag.removeWord(edit.word)) stats.removed++;
+                else stats.notFound++;
+            }
+        }
+        return stats;
+    }
+
+    std::vector<std::string> applyDelta(const std::vector<std::string>& words, const LexiconDelta& delta) {
+        std::set<std::string> lexicon(words.begin(), words.end());
+        for (const LexiconEdit& edit : delta) {
+            if (edit.add) lexicon.insert(edit.word);
+            else lexicon.erase(edit.word);
+        }
+        return std::vector<std::string>(lexicon.begin(), lexicon.end());
+    }
+
+    // Depth-first over a's edges; b must have each one, and nothing else
+    static bool sameNode(const Node* a, const Node* b, std::string& path) {
+        if (a->isTerminal != b->isTerminal || a->children.size() != b->children.size()) return false;
+        for (const auto& edge : a->children) {
+            auto other = b->children.find(edge.first);
+            path.push_back(edge.first);
+            if (other == b->children.end() || !sameNode(edge.second, other->second, path)) return false;
+            path.pop_back();
+        }
+        return true;
+    }
+
+    bool sameGraph(const Gaddag& a, const Gaddag& b, std::string* difference) {
+        std::string path;
+        bool same = sameNode(a.getRoot(), b.getRoot(), path);
+        if (!same && difference) *difference = path;
+        return same;
+    }
+
+    bool verifyDelta(const std::vector<std::string>& words, const LexiconDelta& delta, const Gaddag& updated,
+                     std::string* difference) {
+        Gaddag rebuilt;
+        for (const std::string& word : applyDelta(words, delta)) rebuilt.addWord(word);
+        return sameGraph(updated, rebuilt, difference);
+    }
+
+}
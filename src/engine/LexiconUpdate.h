@@ -0,0 +1,85 @@
+#ifndef LEXICON_UPDATE_H
+#define LEXICON_UPDATE_H
+
+#include "Gaddag.h"
+#include <vector>
+#include <string>
+
+namespace Scrabble {
+
+    /*
+     * Word-list deltas applied to a loaded GADDAG, without rebuilding it.
+     *
+     * A delta file has one edit per line: "+WORD" adds a word, "-WORD" removes
+     * one; blank lines and lines starting with '#' are ignored. Words are
+     * normalized as loadFromFile reads them. Edits apply in file order.
+     *
+     * The GADDAG is an unminimized trie: every path belongs to one word, so an
+     * update only touches that word's paths. Adding inserts them; removing
+     * clears their terminals and unlinks the nodes no other path goes through
+     * (their memory stays in the GADDAG's arena until the next load).
+     * The result is the graph a full rebuild from the updated word list would
+     * produce (sameGraph checks this; the binary files may still differ in child
+     * order).
+     */
+
+    struct LexiconEdit {
+        bool add;               // false: remove
+        std::string word;       // Normalized
+    };
+
+    using LexiconDelta = std::vector<LexiconEdit>;
+
+    struct DeltaStats {
+        size_t added = 0;
+        size_t removed = 0;
+        size_t alreadyPresent = 0;  // Additions of words already in the lexicon
+        size_t notFound = 0;        // Removals of words not in the lexicon
+    };
+
+    /**
+     * Read a delta file.
+     * @param filePath Delta file (see above)
+     * @param delta Filled with the edits in file order
+     * @return false on I/O error or a malformed line (reported on std::cerr)
+     */
+    bool loadDelta(const std::string& filePath, LexiconDelta& delta);
+
+    /**
+     * Read a word list as loadFromFile does (one word per line, normalized).
+     * @return false on I/O error
+     */
+    bool loadWordList(const std::string& filePath, std::vector<std::string>& words);
+
+    /**
+     * Apply a delta in place. Not safe while other threads read the dictionary.
+     * @return What changed
+     */
+    DeltaStats applyDelta(Gaddag& gaddag, const LexiconDelta& delta);
+
+    /**
+     * Apply a delta to a word list: the result is sorted, without duplicates.
+     */
+    std::vector<std::string> applyDelta(const std::vector<std::string>& words, const LexiconDelta& delta);
+
+    /**
+     * Compare two GADDAGs node by node.
+     * @param difference If not null, receives the path of the first difference
+     * @return true if both graphs have the same edges and terminals
+     */
+    bool sameGraph(const Gaddag& a, const Gaddag& b, std::string* difference = nullptr);
+
+    /**
+     * Verifier: rebuild from the updated word list and compare with an updated GADDAG.
+     * @param words Word list the GADDAG was built from, before the delta
+     * @param delta Delta applied to it
+     * @param updated GADDAG after applyDelta
+     * @param difference If not null, receives the path of the first difference
+     * @return true if the incremental update matches the full rebuild
+     */
+    bool verifyDelta(const std::vector<std::string>& words, const LexiconDelta& delta, const Gaddag& updated,
+                     std::string* difference = nullptr);
+
+}
+
+#endif // LEXICON_UPDATE_H
@@ -0,0 +1,101 @@
+#include "MoveCache.h"
+#include "Instrumentation.h"
+#include "Rules.h"
+#include <algorithm>
+
+namespace Scrabble {
+
+    MoveCache::MoveCache(size_t maxEntries)
+        : maxEntries(std::max<size_t>(1, maxEntries)), dictionary(0),
+          lineHits(0), lineMisses(0), columnHits(0), columnMisses(0) {}
+
+    void MoveCache::clear() {
+        lines.clear();
+        columns.clear();
+    }
+
+    // Tiles of a row or column, '.' for empty squares
+    static void appendLine(std::string& key, const Board& board, int index, bool column) {
+        for (int i = 0; i < 15; ++i) {
+            const Tile t = column ? board.getTile(i, index) : board.getTile(index, i);
+            key += t.isEmpty() ? '.' : t.letter;
+        }
+    }
+
+    std::vector<Move> MoveCache::generateMoves(const Board& board, const std::vector<char>& rack,
+                                               const MoveGenerator& generator, const Gaddag& gaddag) {
+        if (dictionary != gaddag.getRevision()) {
+            clear();
+            dictionary = gaddag.getRevision();
+        }
+        if (lines.size() > maxEntries) lines.clear();
+        if (columns.size() > maxEntries) columns.clear();
+
+        uint32_t crossChecks[15][15];
+        {
+            SCRABBLE_STAGE_TIMER(StageCrossChecks);
+            std::string key;
+            for (int c = 0; c < 15; ++c) {
+                key.clear();
+                appendLine(key, board, c, true);
+                auto it = columns.find(key);
+                if (it != columns.end()) {
+                    columnHits++;
+                } else {
+                    columnMisses++;
+                    std::array<uint32_t, 15> checks;
+                    generator.computeColumnCrossChecks(board, gaddag, c, checks.data());
+                    it = columns.emplace(key, checks).first;
+                }
+                for (int r = 0; r < 15; ++r) crossChecks[r][c] = it->second[r];
+            }
+        }
+
+        int anchors[225];
+        int anchorCount;
+        {
+            SCRABBLE_STAGE_TIMER(StageAnchors);
+            anchorCount = generator.findAnchors(board, anchors);
+        }
+
+        // Blanks are interchangeable and the order of the rack does not matter
+        std::string rackKey(rack.begin(), rack.end());
+        for (char& c : rackKey) {
+            if (isBlankTile(c)) c = BLANK_TILE;
+        }
+        std::sort(rackKey.begin(), rackKey.end());
+
+        std::vector<Move> moves;
+        SCRABBLE_STAGE_TIMER(StageTraversal);
+        std::string key;
+        for (int i = 0; i < anchorCount;) {
+            // Anchors are in row-major order: take this row's run
+            int row = anchors[i] / 15, first = i;
+            uint16_t anchorMask = 0;
+            while (i < anchorCount && anchors[i] / 15 == row) anchorMask |= (uint16_t)(1u << (anchors[i++] % 15));
+
+            key.clear();
+            appendLine(key, board, row, false);
+            key.append(reinterpret_cast<const char*>(crossChecks[row]), sizeof(crossChecks[row]));
+            key.append(reinterpret_cast<const char*>(&anchorMask), sizeof(anchorMask));
+            key += rackKey;
+
+            auto it = lines.find(key);
+            if (it != lines.end()) {
+                lineHits++;
+            } else {
+                lineMisses++;
+                std::vector<Move> found;
+                generator.generateFromAnchors(board, rack, gaddag, crossChecks, anchors + first, i - first, found);
+                for (Move& m : found) m.row = 0;
+                it = lines.emplace(key, std::move(found)).first;
+            }
+            for (const Move& m : it->second) {
+                moves.push_back(m);
+                moves.back().row = row;
+            }
+        }
+        return moves;
+    }
+
+}
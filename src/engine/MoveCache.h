@@ -0,0 +1,65 @@
+#ifndef MOVE_CACHE_H
+#define MOVE_CACHE_H
+
+#include "engine.h"
+#include "Gaddag.h"
+#include "MoveGenerator.h"
+#include <vector>
+#include <string>
+#include <unordered_map>
+#include <array>
+#include <cstdint>
+
+namespace Scrabble {
+
+    /*
+     * Line-level memo for repeated generation on boards that differ in a few lines
+     * (consecutive turns, replays, evaluating an opponent reply after each candidate).
+     *
+     * The horizontal moves of a row depend only on the row's tiles, its cross-checks,
+     * its anchors and the rack; the cross-checks of a square depend only on the tiles
+     * of its column. The cache keeps both tables: cross-checks by column contents, and
+     * the moves of a row by (row tiles, row cross-checks, anchors, rack multiset).
+     * A play changes one line and the columns (or rows) it crosses, so only those are
+     * recomputed. The vertical pass runs on the transposed board and shares the tables.
+     *
+     * Not thread-safe: use one cache per thread, like MoveGenerator scratch state.
+     */
+    class MoveCache {
+    private:
+        std::unordered_map<std::string, std::vector<Move>> lines;          // Moves with row 0
+        std::unordered_map<std::string, std::array<uint32_t, 15>> columns;  // Cross-checks by column tiles
+        size_t maxEntries;
+        uint64_t dictionary;    // Revision of the dictionary the entries came from, 0 for none
+        size_t lineHits, lineMisses, columnHits, columnMisses;
+
+    public:
+        /**
+         * @param maxEntries Each table is cleared when it grows past this many lines
+         */
+        explicit MoveCache(size_t maxEntries = 4096);
+
+        /**
+         * Same moves as generator.generateMoves(board, rack, gaddag), possibly in a
+         * different order; only lines not seen before are generated.
+         * @param board The current game board.
+         * @param rack The player's rack.
+         * @param generator Move generator.
+         * @param gaddag The dictionary (the cache is cleared when another dictionary is passed,
+         *               or when this one was reloaded or edited since, see Gaddag::getRevision).
+         * @return Horizontal moves.
+         */
+        std::vector<Move> generateMoves(const Board& board, const std::vector<char>& rack,
+                                        const MoveGenerator& generator, const Gaddag& gaddag);
+
+        void clear();
+
+        size_t hits() const { return lineHits; }
+        size_t misses() const { return lineMisses; }
+        size_t crossCheckHits() const { return columnHits; }
+        size_t crossCheckMisses() const { return columnMisses; }
+    };
+
+}
+
+#endif // MOVE_CACHE_H
@@ -1,29 +1,103 @@
 #include "MoveGenerator.h"
+#include "SuccinctGaddag.h"
+#include "LazyGaddag.h"
+#include "Instrumentation.h"
 #include <algorithm>
+#include <cctype>
 #include <iostream>
 
 namespace Scrabble {
 
-    MoveGenerator::MoveGenerator() {}
-    MoveGenerator::~MoveGenerator() {}
+    template <int N>
+    bool BasicSquareMask<N>::empty() const {
+        for (int r = 0; r < N; ++r) {
+            if (rows[r]) return false;
+        }
+        return true;
+    }
+
+    template <int N>
+    BasicSquareMask<N> BasicSquareMask<N>::transposed() const {
+        BasicSquareMask t;
+        for (int r = 0; r < N; ++r) {
+            for (int c = 0; c < N; ++c) {
+                if (test(r, c)) t.set(c, r);
+            }
+        }
+        return t;
+    }
 
-    bool MoveGenerator::isAnchor(const Board& board, int row, int col) const {
+    template <int N>
+    bool BasicSquareMask<N>::touches(int row, int first, int last) const {
+        if (first < 0) first = 0;
+        if (last > N - 1) last = N - 1;
+        if (first > last) return false;
+        uint32_t span = ((1u << (last + 1)) - 1) & ~((1u << first) - 1);
+        return (rows[row] & span) != 0;
+    }
+
+    // For each masked row, how far a word can extend with k rack tiles:
+    // left[c][k] is the leftmost column reachable when the word covers c and
+    // continues left, right[c][k] the rightmost when it continues from c rightwards.
+    template <int N>
+    struct BasicMoveGenerator<N>::MaskBounds {
+        SquareMask mask;
+        int8_t left[N][N][16];
+        int8_t right[N][N + 1][16];
+
+        MaskBounds(const Board& board, const SquareMask& m) : mask(m) {
+            for (int r = 0; r < N; ++r) {
+                if (!mask.rows[r]) continue;
+                for (int c = 0; c < N; ++c) {
+                    for (int k = 0; k < 16; ++k) {
+                        int tiles = k, pos = c;
+                        while (pos >= 0 && (!board.isEmpty(r, pos) || tiles-- > 0)) pos--;
+                        left[r][c][k] = (int8_t)(pos + 1);
+                    }
+                }
+                for (int c = 0; c <= N; ++c) {
+                    for (int k = 0; k < 16; ++k) {
+                        int tiles = k, pos = c;
+                        while (pos < N && (!board.isEmpty(r, pos) || tiles-- > 0)) pos++;
+                        right[r][c][k] = (int8_t)(pos - 1);
+                    }
+                }
+            }
+        }
+
+        static int tiles(const std::vector<char>& rack) { return std::min<int>((int)rack.size(), 15); }
+    };
+
+    SearchBudget SearchBudget::within(std::chrono::microseconds timeout) {
+        SearchBudget budget;
+        budget.deadline = std::chrono::steady_clock::now() + timeout;
+        budget.hasDeadline = true;
+        return budget;
+    }
+
+    template <int N>
+    BasicMoveGenerator<N>::BasicMoveGenerator() {}
+    template <int N>
+    BasicMoveGenerator<N>::~BasicMoveGenerator() {}
+
+    template <int N>
+    bool BasicMoveGenerator<N>::isAnchor(const Board& board, int row, int col) const {
         if (!board.isEmpty(row, col)) return false;
 
         // Check limits
-        if (row < 0 || row >= 15 || col < 0 || col >= 15) return false;
+        if (row < 0 || row >= N || col < 0 || col >= N) return false;
 
         // Check if adjacent to a filled square
         bool hasNeighbor = false;
         if (row > 0 && !board.isEmpty(row - 1, col)) hasNeighbor = true;
-        if (row < 14 && !board.isEmpty(row + 1, col)) hasNeighbor = true;
+        if (row < N - 1 && !board.isEmpty(row + 1, col)) hasNeighbor = true;
         if (col > 0 && !board.isEmpty(row, col - 1)) hasNeighbor = true;
-        if (col < 14 && !board.isEmpty(row, col + 1)) hasNeighbor = true;
+        if (col < N - 1 && !board.isEmpty(row, col + 1)) hasNeighbor = true;
 
         if (hasNeighbor) return true;
 
         // Center square is an anchor if board is empty (start of game)
-        if (row == 7 && col == 7) {
+        if (row == Board::CENTER && col == Board::CENTER) {
             // Check if board is truly empty (naive check)
             // Ideally we pass a flag 'isFirstMove', but checking center emptiness + neighbors is mostly correct for first move logic
             // Actually, if center is empty, it MUST be the first move or a subsequent move connecting through it,
@@ -37,7 +111,19 @@ namespace Scrabble {
     // Check if placing 'letter' at (row, col) forms valid cross-words
     // This is a naive implementation using checks for neighbors.
     // In efficient engines, this is pre-computed.
-    bool checkCrossWord(const Board& board, const Gaddag& gaddag, int row, int col, char letter) {
+    template <typename Dict>
+    static bool crossWordInLexicon(const Dict& gaddag, const std::string& word, size_t) {
+        return gaddag.contains(word);
+    }
+
+    // Pivot on a board tile next to the square: the walk leaves the root through that
+    // tile's page, not through the page of each letter tried
+    static bool crossWordInLexicon(const LazyGaddag& gaddag, const std::string& word, size_t pivot) {
+        return gaddag.contains(word, pivot);
+    }
+
+    template <int N, typename Dict>
+    static bool checkCrossWord(const BasicBoard<N>& board, const Dict& gaddag, int row, int col, char letter) {
         // Construct vertical word
         std::string word = "";
         word += letter;
@@ -48,21 +134,43 @@ namespace Scrabble {
             word.insert(0, 1, board.getTile(r, col).letter);
             r--;
         }
-        
+        size_t above = word.length() - 1;
+
         // Scan down
         r = row + 1;
-        while (r < 15 && !board.isEmpty(r, col)) {
+        while (r < N && !board.isEmpty(r, col)) {
             word += board.getTile(r, col).letter;
             r++;
         }
 
         if (word.length() == 1) return true; // No cross-word formed
-        return gaddag.contains(word);
+        return crossWordInLexicon(gaddag, word, above > 0 ? above - 1 : above + 1);
+    }
+
+    template <int N>
+    void BasicMoveGenerator<N>::computeCrossChecks(const Board& board, const Gaddag& gaddag, uint32_t crossChecks[N][N]) const {
+        computeCrossChecks(board, gaddag, crossChecks, SquareMask::ALL);
+    }
+
+    template <int N>
+    void BasicMoveGenerator<N>::computeCrossChecks(const Board& board, const Gaddag& gaddag, uint32_t crossChecks[N][N],
+                                                   RowMask rowMask) const {
+        fillCrossChecks(board, gaddag, crossChecks, rowMask);
     }
 
-    void MoveGenerator::computeCrossChecks(const Board& board, const Gaddag& gaddag, uint32_t crossChecks[15][15]) const {
-        for(int i=0; i<15; ++i) {
-            for(int j=0; j<15; ++j) {
+    template <int N>
+    void BasicMoveGenerator<N>::computeCrossChecks(const Board& board, const SuccinctGaddag& dictionary,
+                                                   uint32_t crossChecks[N][N]) const {
+        fillCrossChecks(board, dictionary, crossChecks, SquareMask::ALL);
+    }
+
+    template <int N>
+    template <typename Dict>
+    void BasicMoveGenerator<N>::fillCrossChecks(const Board& board, const Dict& gaddag, uint32_t crossChecks[N][N],
+                                                RowMask rowMask) const {
+        for(int i=0; i<N; ++i) {
+            if (!((rowMask >> i) & 1u)) continue;
+            for(int j=0; j<N; ++j) {
                 crossChecks[i][j] = 0;
                 
                 // If the square is occupied, cross-check is irrelevant (or full mask)
@@ -85,202 +193,629 @@ namespace Scrabble {
         }
     }
 
-    std::vector<Move> MoveGenerator::generateMoves(const Board& board, const std::vector<char>& rack, const Gaddag& gaddag) const {
+    template <int N>
+    void BasicMoveGenerator<N>::computeColumnCrossChecks(const Board& board, const Gaddag& gaddag, int col,
+                                                         uint32_t checks[N]) const {
+        for (int r = 0; r < N; ++r) {
+            if (!board.isEmpty(r, col)) {
+                checks[r] = 0x3FFFFFF;
+                continue;
+            }
+            checks[r] = 0;
+            for (char c = 'A'; c <= 'Z'; ++c) {
+                if (checkCrossWord(board, gaddag, r, col, c)) checks[r] |= (1 << (c - 'A'));
+            }
+        }
+    }
+
+    template <int N>
+    int BasicMoveGenerator<N>::findAnchors(const Board& board, int anchors[N * N]) const {
+        int count = 0;
+        for (int r = 0; r < N; ++r) {
+            for (int c = 0; c < N; ++c) {
+                if (isAnchor(board, r, c)) anchors[count++] = r * N + c;
+            }
+        }
+        return count;
+    }
+
+    template <int N>
+    template <typename Dict>
+    struct BasicMoveGenerator<N>::Traversal {
+        const Dict& dict;
+        const Board& board;
+        const uint32_t (*crossChecks)[N];
+        GenContext& context;
+        std::vector<Move>& moves;
+        const MaskBounds* bounds;
+        SearchBudget* budget;
+        int row;
+        int anchorCol;
+    };
+
+    template <int N>
+    std::vector<Move> BasicMoveGenerator<N>::generateMoves(const Board& board, const std::vector<char>& rack, const Gaddag& gaddag) const {
+        GenContext context;
+        generateMoves(board, rack, gaddag, context);
+        return std::move(context.moves);
+    }
+
+    template <int N>
+    const std::vector<Move>& BasicMoveGenerator<N>::generateMoves(const Board& board, const std::vector<char>& rack,
+                                                                  const Gaddag& gaddag, GenContext& context) const {
+        return generate(board, rack, gaddag, context);
+    }
+
+    template <int N>
+    std::vector<Move> BasicMoveGenerator<N>::generateMoves(const Board& board, const std::vector<char>& rack,
+                                                           const SuccinctGaddag& dictionary) const {
+        GenContext context;
+        generate(board, rack, dictionary, context);
+        return std::move(context.moves);
+    }
+
+    template <int N>
+    const std::vector<Move>& BasicMoveGenerator<N>::generateMoves(const Board& board, const std::vector<char>& rack,
+                                                                  const SuccinctGaddag& dictionary,
+                                                                  GenContext& context) const {
+        return generate(board, rack, dictionary, context);
+    }
+
+    template <int N>
+    std::vector<Move> BasicMoveGenerator<N>::generateMoves(const Board& board, const std::vector<char>& rack,
+                                                           const LazyGaddag& dictionary) const {
+        GenContext context;
+        generateMoves(board, rack, dictionary, context);
+        return std::move(context.moves);
+    }
+
+    template <int N>
+    const std::vector<Move>& BasicMoveGenerator<N>::generateMoves(const Board& board, const std::vector<char>& rack,
+                                                                  const LazyGaddag& dictionary,
+                                                                  GenContext& context) const {
+        // Warm: the complete graph, without the root test of every lookup
+        if (dictionary.isWarm()) return generate(board, rack, dictionary.gaddag(), context);
+        return generate(board, rack, dictionary, context);
+    }
+
+    template <int N>
+    std::vector<Move> BasicMoveGenerator<N>::generateMovesInterleaved(const Board& board, const std::vector<char>& rack,
+                                                                      const Gaddag& gaddag) const {
+        GenContext context;
+        generateMovesInterleaved(board, rack, gaddag, context);
+        return std::move(context.moves);
+    }
+
+    template <int N>
+    const std::vector<Move>& BasicMoveGenerator<N>::generateMovesInterleaved(const Board& board,
+                                                                             const std::vector<char>& rack,
+                                                                             const Gaddag& gaddag,
+                                                                             GenContext& context) const {
+        context.moves.clear();
+        {
+            SCRABBLE_STAGE_TIMER(StageCrossChecks);
+            fillCrossChecks(board, gaddag, context.crossChecks, SquareMask::ALL);
+        }
+
+        int anchorCount;
+        {
+            SCRABBLE_STAGE_TIMER(StageAnchors);
+            anchorCount = findAnchors(board, context.anchors);
+        }
+        {
+            SCRABBLE_STAGE_TIMER(StageTraversal);
+            interleaveAnchors(board, rack, gaddag, context.crossChecks, context.anchors, anchorCount, context.moves);
+        }
+        return context.moves;
+    }
+
+    template <int N>
+    template <typename Dict>
+    const std::vector<Move>& BasicMoveGenerator<N>::generate(const Board& board, const std::vector<char>& rack,
+                                                             const Dict& gaddag, GenContext& context) const {
+        context.moves.clear();
+        {
+            SCRABBLE_STAGE_TIMER(StageCrossChecks);
+            fillCrossChecks(board, gaddag, context.crossChecks, SquareMask::ALL);
+        }
+
+        int anchorCount;
+        {
+            SCRABBLE_STAGE_TIMER(StageAnchors);
+            anchorCount = findAnchors(board, context.anchors);
+        }
+        {
+            SCRABBLE_STAGE_TIMER(StageTraversal);
+            traverseAnchors(board, rack, gaddag, context.crossChecks, context.anchors, anchorCount, context.moves,
+                            nullptr, nullptr, context);
+        }
+        return context.moves;
+    }
+
+    template <int N>
+    std::vector<Move> BasicMoveGenerator<N>::generateMoves(const Board& board, const std::vector<char>& rack,
+                                                           const Gaddag& gaddag, const SquareMask& mask) const {
         std::vector<Move> moves;
-        uint32_t crossChecks[15][15];
-        computeCrossChecks(board, gaddag, crossChecks);
-
-        Node* root = gaddag.getRoot();
-        
-        // Horizontal Pass
-        for (int r = 0; r < 15; ++r) {
-            for (int c = 0; c < 15; ++c) {
-                if (isAnchor(board, r, c)) {
-                    // Start generation with (r,c) as the "Pivot" (L1 in GADDAG path)
-                    // We place/match a letter at (r, c).
-                    // This covers ALL words because every word has at least one letter, and every letter can be a pivot.
-                    // (Actually GADDAG ensures every word has a pivot L1).
-                    
-                    // We call genLeft starting at (r,c).
-                    // genLeft will:
-                    // 1. Try to place/match a letter at curr_col.
-                    // 2. If successful, check if Pivot formed (Arc->Delimiter calls genRight).
-                    // 3. Recurse Left.
-                    
-                    genLeft(r, c, "", rack, root, r, c, board, crossChecks, moves);
-                }
+        if (mask.empty()) return moves;
+
+        // A horizontal word lies in one row, so only the masked rows matter
+        RowMask rowMask = 0;
+        for (int r = 0; r < N; ++r) {
+            if (mask.rows[r]) rowMask |= (RowMask)(1u << r);
+        }
+        GenContext context;
+        {
+            SCRABBLE_STAGE_TIMER(StageCrossChecks);
+            computeCrossChecks(board, gaddag, context.crossChecks, rowMask);
+        }
+
+        int anchorCount = 0;
+        MaskBounds bounds(board, mask);
+        {
+            SCRABBLE_STAGE_TIMER(StageAnchors);
+            int all[N * N];
+            int count = findAnchors(board, all);
+            int k = MaskBounds::tiles(rack);
+            for (int i = 0; i < count; ++i) {
+                int r = all[i] / N, c = all[i] % N;
+                if (mask.touches(r, bounds.left[r][c][k], bounds.right[r][c + 1][k])) context.anchors[anchorCount++] = all[i];
             }
         }
+        {
+            SCRABBLE_STAGE_TIMER(StageTraversal);
+            traverseAnchors(board, rack, gaddag, context.crossChecks, context.anchors, anchorCount, moves, &bounds,
+                            nullptr, context);
+        }
         return moves;
     }
 
-    void MoveGenerator::genLeft(int row, int col, std::string prefix, const std::vector<char>& rack, 
-                            Node* arc, int anchorRow, int anchorCol,
-                            const Board& board, const uint32_t crossChecks[15][15], 
-                            std::vector<Move>& moves) const {
-        
-        if (col < 0) return; // Board edge
+    template <int N>
+    void BasicMoveGenerator<N>::generateFromAnchors(const Board& board, const std::vector<char>& rack, const Gaddag& gaddag,
+                                                    const uint32_t crossChecks[N][N], const int* anchors, int anchorCount,
+                                                    std::vector<Move>& moves) const {
+        GenContext context;
+        traverseAnchors(board, rack, gaddag, crossChecks, anchors, anchorCount, moves, nullptr, nullptr, context);
+    }
+
+    template <int N>
+    int BasicMoveGenerator<N>::generateFromAnchors(const Board& board, const std::vector<char>& rack, const Gaddag& gaddag,
+                                                   const uint32_t crossChecks[N][N], const int* anchors, int anchorCount,
+                                                   std::vector<Move>& moves, SearchBudget& budget) const {
+        GenContext context;
+        return traverseAnchors(board, rack, gaddag, crossChecks, anchors, anchorCount, moves, nullptr, &budget, context);
+    }
 
-        // Helper lambda to process a letter L at (row, col)
-        auto processLetter = [&](char L, Node* nextArc, const std::vector<char>& nextRack) {
-            // New Prefix: append L to "prefix" (which stores the word fragment reversed? No, let's store it normal sequence for simplicity?)
-            // But GADDAG traversal is L1 -> L2 -> L3. Word is ...L3 L2 L1.
-            // So if we traverse C->A. Word is ...AC.
-            // Effectively we present letters in Reverse order to `gen` (Right).
-            // `prefix` here will accumulate the "GADDAG Path Letters".
-            // So if path is C->A. `prefix` = "CA".
-            // When we switch to Right, we reverse it: "AC".
-            
-            std::string newPrefix = prefix + L;
-            
-            // 1. Check for Delimiter (Pivot Point)
-            // If the arc has a delimiter, it means the sequence we just traced (L...L1) is a valid Prefix.
-            // The Split point is AFTER (row, col) (to the right).
-            // i.e. Suffix starts at col + 1 ?
-            // NO. The Anchor of generation was `anchorCol`.
-            // We started at `anchorCol`. We are now at `col` (<= anchorCol).
-            // The split is always immediately to the right of the INITIAL Pivot?
-            // No. The split is immediately to the right of the CURRENT letter being placed?
-            // GADDAG: L1 L2 .. D R1 ..
-            // We correspond to L1, L2...
-            // Wait.
-            // Path: C -> D -> ... (Word C...)
-            // Path: A -> C -> D -> ... (Word CA...)
-            // So the Delimiter is ALWAYS reached after processing the Left Part.
-            // And the Right Part starts immediately to the right of the L1 (The FIRST letter of path).
-            // L1 is at `anchorCol`.
-            // So Right Part starts at `anchorCol + 1`.
-            
-            if (nextArc->children.count(GADDAG_DELIMITER)) {
-                 Node* rightStartArc = nextArc->children[GADDAG_DELIMITER];
-                 std::string wordSoFar = newPrefix;
-                 std::reverse(wordSoFar.begin(), wordSoFar.end());
-                 
-                 // We must check if we are ALLOWED to stop going left.
-                 // We can only stop going left if the square to the left (col-1) is empty!
-                 // If (col-1) is occupied, we MUST include it in the word.
-                 if (col == 0 || board.isEmpty(row, col - 1)) {
-                      gen(row, anchorCol + 1, wordSoFar, nextRack, rightStartArc, nextArc, 0, board, crossChecks, moves);
-                 }
+    // Rack tiles by letter, blanks last; returns the number of tiles
+    static int rackCounts(const std::vector<char>& rack, int counts[27]) {
+        std::fill(counts, counts + 27, 0);
+        int tiles = 0;
+        for (char tile : rack) {
+            if (tile == '?' || tile == '*') {
+                counts[26]++;
+            } else if (std::isalpha((unsigned char)tile)) {
+                counts[std::toupper((unsigned char)tile) - 'A']++;
+            } else {
+                continue;
             }
-            
-            // 2. Recurse Left
-            // Only if we can (col > 0) AND we are not blocked?
-            // Actually standard limits apply.
-            // But if (col-1) is empty, we consume rack.
-            // If (col-1) occupied, we match.
-            // Optimization: If we just placed a tile on Anchor, we can go left.
-            // If we are left of anchor, we continue.
-            genLeft(row, col - 1, newPrefix, nextRack, nextArc, anchorRow, anchorCol, board, crossChecks, moves);
+            tiles++;
+        }
+        return tiles;
+    }
+
+    // Appends the horizontal move of word[0..length) ending just before col, if it places at least one tile
+    static void appendMove(std::vector<Move>& moves, int row, const char* line, const char* word, int col, int length) {
+        int startCol = col - length;
+        int tileCount = 0;
+        for (int i = 0; i < length; ++i) {
+            if (!line[startCol + i]) tileCount++;
+        }
+        if (tileCount == 0) return;
+
+        SCRABBLE_COUNT(movesRecorded, 1);
+        moves.emplace_back();
+        Move& m = moves.back();
+        m.row = row;
+        m.col = startCol;
+        m.horizontal = true;
+        m.word.assign(word, length);
+        m.tileCount = tileCount;
+        int placed = 0;
+        for (int i = 0; i < length; ++i) {
+            // Placeholder value; resolveTiles assigns the real tiles and blanks
+            if (!line[startCol + i]) m.tiles[placed++] = Tile(word[i], 1);
+        }
+    }
+
+    template <int N>
+    template <typename Dict>
+    int BasicMoveGenerator<N>::traverseAnchors(const Board& board, const std::vector<char>& rack, const Dict& dict,
+                                               const uint32_t crossChecks[N][N], const int* anchors, int anchorCount,
+                                               std::vector<Move>& moves, const MaskBounds* bounds, SearchBudget* budget,
+                                               GenContext& context) const {
+        // The rack as letter counts: tiles are taken and put back as the traversal backtracks
+        context.tiles = rackCounts(rack, context.counts);
+
+        using Self = BasicMoveGenerator;
+        using Kernel = void (Self::*)(Traversal<Dict>&, int, typename Dict::Cursor, int) const;
+        static const Kernel KERNELS[KernelCount] = {
+            &Self::template genLeft<Dict, 0>,  &Self::template genLeft<Dict, 1>,  &Self::template genLeft<Dict, 2>,
+            &Self::template genLeft<Dict, 3>,  &Self::template genLeft<Dict, 4>,  &Self::template genLeft<Dict, 5>,
+            &Self::template genLeft<Dict, 6>,  &Self::template genLeft<Dict, 7>,  &Self::template genLeft<Dict, 8>,
+            &Self::template genLeft<Dict, 9>,  &Self::template genLeft<Dict, 10>, &Self::template genLeft<Dict, 11>,
+            &Self::template genLeft<Dict, 12>, &Self::template genLeft<Dict, 13>, &Self::template genLeft<Dict, 14>,
+            &Self::template genLeft<Dict, 15>,
         };
+        unsigned flags = (context.counts[26] > 0 ? KernelBlanks : 0u) | (bounds ? KernelMasked : 0u) |
+                         (budget ? KernelBudget : 0u);
 
-        if (board.isEmpty(row, col)) {
-            // Try all letters in rack
-             for (size_t i = 0; i < rack.size(); ++i) {
-                char rackTile = rack[i];
-                std::vector<char> nextRack = rack;
-                nextRack.erase(nextRack.begin() + i);
-
-                auto tryChar = [&](char C) {
-                    if (arc->children.count(C)) {
-                        if (crossChecks[row][col] & (1 << (C - 'A'))) {
-                             processLetter(C, arc->children[C], nextRack);
-                        }
-                    }
-                };
+        const typename Dict::Cursor root = dict.rootCursor();
+        Traversal<Dict> t{dict, board, crossChecks, context, moves, bounds, budget, -1, 0};
+        bool rowTiles = false;
+        for (int i = 0; i < anchorCount; ++i) {
+            // Start generation with (r,c) as the "Pivot" (L1 in GADDAG path).
+            // This covers ALL words because every word has at least one letter, and every letter can be a pivot.
+            // genLeft places/matches a letter at the current column, pivots to the right part
+            // when the path has a delimiter, then recurses left.
+            int row = anchors[i] / N;
+            if (row != t.row) {
+                t.row = row;
+                rowTiles = false;
+                for (int c = 0; c < N; ++c) {
+                    const Tile tile = board.getTile(row, c);
+                    context.line[c] = tile.isEmpty() ? 0 : tile.letter;
+                    rowTiles = rowTiles || context.line[c];
+                }
+            }
+            t.anchorCol = anchors[i] % N;
+            (this->*KERNELS[flags | (rowTiles ? KernelRowTiles : 0u)])(t, t.anchorCol, root, 0);
+
+            // An interrupted anchor may have missed moves: it does not count as traversed
+            if (budget && budget->expired) return i;
+        }
+        return anchorCount;
+    }
+
+    template <int N>
+    template <typename Dict, unsigned Flags, typename Next>
+    void BasicMoveGenerator<N>::tryRack(Traversal<Dict>& t, int col, typename Dict::Cursor arc, Next next) const {
+        GenContext& context = t.context;
+        if (context.tiles == 0) return;
+        uint32_t allowed = t.crossChecks[t.row][col];
+        int* counts = context.counts;
 
-                if (rackTile == '?' || rackTile == '*') {
-                    for (char c = 'A'; c <= 'Z'; ++c) tryChar(c);
-                } else {
-                    tryChar(rackTile);
+        if ((Flags & KernelBlanks) && counts[26] > 0) {
+            // With a blank every letter is possible: walk the children instead of the rack.
+            // A real tile is used when there is one; the blank only stands in for missing
+            // letters, so each word is found once and resolveTiles picks the tiles later.
+            SCRABBLE_COUNT(blankExpansions, 1);
+            t.dict.forEachChild(arc, [&](char L, typename Dict::Cursor child) {
+                if (L < 'A' || L > 'Z') return;
+                SCRABBLE_COUNT(rackAttempts, 1);
+                SCRABBLE_COUNT(arcsTried, 1);
+                if (!((allowed >> (L - 'A')) & 1u)) {
+                    SCRABBLE_COUNT(crossCheckRejects, 1);
+                    return;
                 }
-             }
+                int tile = counts[L - 'A'] > 0 ? L - 'A' : 26;
+                counts[tile]--;
+                context.tiles--;
+                next(L, child);
+                counts[tile]++;
+                context.tiles++;
+            });
+            return;
+        }
+
+        for (int l = 0; l < 26; ++l) {
+            if (counts[l] == 0) continue;
+            char L = (char)('A' + l);
+            SCRABBLE_COUNT(rackAttempts, 1);
+            SCRABBLE_COUNT(arcsTried, 1);
+            typename Dict::Cursor child;
+            if (!t.dict.child(arc, L, child)) continue;
+            if (!((allowed >> l) & 1u)) {
+                SCRABBLE_COUNT(crossCheckRejects, 1);
+                continue;
+            }
+            counts[l]--;
+            context.tiles--;
+            next(L, child);
+            counts[l]++;
+            context.tiles++;
+        }
+    }
+
+    template <int N>
+    template <typename Dict, unsigned Flags>
+    void BasicMoveGenerator<N>::genLeft(Traversal<Dict>& t, int col, typename Dict::Cursor arc, int depth) const {
+        if (col < 0) return; // Board edge
+        if (Flags & KernelMasked) {
+            // The word covers col..anchorCol and may grow both ways with the tiles left
+            int k = std::min(t.context.tiles, 15);
+            if (!t.bounds->mask.touches(t.row, t.bounds->left[t.row][col][k], t.bounds->right[t.row][t.anchorCol + 1][k])) return;
+        }
+        if ((Flags & KernelBudget) && t.budget->spend()) return;
+        SCRABBLE_COUNT(nodesVisited, 1);
+
+        char L = (Flags & KernelRowTiles) ? t.context.line[col] : 0;
+        if (!L) {
+            tryRack<Dict, Flags>(t, col, arc, [&](char letter, typename Dict::Cursor next) {
+                leftLetter<Dict, Flags>(t, col, letter, next, depth);
+            });
         } else {
-            // Occupied
-            char L = board.getTile(row, col).letter;
-            if (arc->children.count(L)) {
-                 processLetter(L, arc->children[L], rack);
+            // Occupied: the path must follow the tile on the board
+            SCRABBLE_COUNT(arcsTried, 1);
+            typename Dict::Cursor child;
+            if (t.dict.child(arc, L, child)) leftLetter<Dict, Flags>(t, col, L, child, depth);
+        }
+    }
+
+    template <int N>
+    template <typename Dict, unsigned Flags>
+    void BasicMoveGenerator<N>::leftLetter(Traversal<Dict>& t, int col, char L, typename Dict::Cursor next, int depth) const {
+        GenContext& context = t.context;
+        context.left[depth++] = L;
+
+        // GADDAG: L1 L2 .. + R1 .. The path so far (anchor first, going left) is a valid
+        // left part when the node has a delimiter; the right part then starts just right
+        // of the anchor. We can only stop going left if the square to the left is empty.
+        typename Dict::Cursor delimiter;
+        if (t.dict.child(next, GADDAG_DELIMITER, delimiter)) {
+            SCRABBLE_COUNT(delimiterTransitions, 1);
+            if (col == 0 || !(Flags & KernelRowTiles) || !context.line[col - 1]) {
+                for (int i = 0; i < depth; ++i) context.word[i] = context.left[depth - 1 - i];
+                gen<Dict, Flags>(t, t.anchorCol + 1, delimiter, depth);
             }
         }
+
+        genLeft<Dict, Flags>(t, col - 1, next, depth);
     }
 
-    void MoveGenerator::gen(int row, int col, std::string word, const std::vector<char>& rack, 
-                            Node* arc, Node* oldArc, int direction, 
-                            const Board& board, const uint32_t crossChecks[15][15], 
-                            std::vector<Move>& moves) const {
-        
-        // 1. Record Move if valid
-        // Condition: Arc is terminal AND square is not occupied (or we are at end of board)
-        // Wait, standard moves can end anywhere if terminal.
-        // BUT if square (row, col) is occupied, we MUST incorporate it. We cannot stop.
-        // So we record ONLY if (col >= 15 OR board.isEmpty(row, col)).
-        
-        if (col >= 15 || board.isEmpty(row, col)) {
-            if (arc->isTerminal) {
-                recordMove(board, row, col, word, true, moves);
+    template <int N>
+    template <typename Dict, unsigned Flags>
+    void BasicMoveGenerator<N>::gen(Traversal<Dict>& t, int col, typename Dict::Cursor arc, int length) const {
+        int start = col - length;
+        if ((Flags & KernelMasked) &&
+            !t.bounds->mask.touches(t.row, start, t.bounds->right[t.row][col][std::min(t.context.tiles, 15)])) {
+            return;
+        }
+
+        // Record Move if valid: the arc is terminal and the word ends here, i.e. at the
+        // board edge or before an empty square (an occupied square must be incorporated).
+        if ((Flags & KernelBudget) && t.budget->spend()) return;
+        SCRABBLE_COUNT(nodesVisited, 1);
+        char L = (Flags & KernelRowTiles) && col < N ? t.context.line[col] : 0;
+        if (!L && t.dict.isTerminal(arc) && (!(Flags & KernelMasked) || t.bounds->mask.touches(t.row, start, col - 1))) {
+            record(t, col, length);
+        }
+
+        if (col >= N) return;
+
+        char* word = t.context.word;
+        if (!L) {
+            tryRack<Dict, Flags>(t, col, arc, [&](char letter, typename Dict::Cursor next) {
+                word[length] = letter;
+                gen<Dict, Flags>(t, col + 1, next, length + 1);
+            });
+        } else {
+            SCRABBLE_COUNT(arcsTried, 1);
+            typename Dict::Cursor child;
+            if (t.dict.child(arc, L, child)) {
+                word[length] = L;
+                gen<Dict, Flags>(t, col + 1, child, length + 1);
             }
         }
-        
-        if (col >= 15) return;
+    }
+
+    template <int N>
+    template <typename Dict>
+    void BasicMoveGenerator<N>::record(Traversal<Dict>& t, int col, int length) const {
+        // 'col' is the position *after* the last letter. Must have placed at least one tile.
+        appendMove(t.moves, t.row, t.context.line, t.context.word, col, length);
+    }
+
+    // --- Interleaved traversal ---
+    // genLeft, leftLetter and gen unrolled into frames. A lane visits one frame per turn;
+    // the frame's node was prefetched when it was pushed, one round of the other lanes ago.
+
+    template <typename Cursor>
+    static inline void prefetchNode(const Cursor&) {}
+
+    // Pointer cursors (Gaddag, LazyGaddag): the node holds the child table's header
+    static inline void prefetchNode(const Node* node) { __builtin_prefetch(node); }
+
+    template <int N>
+    template <typename Dict>
+    struct BasicMoveGenerator<N>::Lane {
+        using Cursor = typename Dict::Cursor;
 
-        auto processLetter = [&](char L, Node* nextArc, const std::vector<char>& nextRack) {
-             gen(row, col + 1, word + L, nextRack, nextArc, arc, direction, board, crossChecks, moves);
+        enum Kind : uint8_t {
+            Left,   // genLeft at col; depth letters in left
+            Pivot,  // leftLetter: left[depth - 1] was just placed or matched at col
+            Right   // gen at col; depth letters in word
         };
 
-        if (board.isEmpty(row, col)) {
-            for (size_t i = 0; i < rack.size(); ++i) {
-                char rackTile = rack[i];
-                std::vector<char> nextRack = rack;
-                nextRack.erase(nextRack.begin() + i);
-                
-                auto tryChar = [&](char C) {
-                    if (arc->children.count(C)) {
-                        if (crossChecks[row][col] & (1 << (C - 'A'))) {
-                             processLetter(C, arc->children[C], nextRack);
-                        }
-                    }
-                };
+        struct Frame {
+            Cursor arc;
+            Kind kind;
+            int8_t col;
+            int8_t depth;
+            int8_t next;    // Next letter to try, -1 before the first visit
+            int8_t taken;   // Rack tile taken for the child being explored, -1 if none
+            bool blanks;    // The rack held a blank at the first visit: try every letter
+        };
+
+        // A pivot becomes the left frame of the next column, so the stack holds at most one
+        // frame per column on the left, plus one per column right of the anchor
+        Frame stack[2 * N + 2];
+        int top = 0;        // Frames on the stack; 0 when the lane is free
+        int row = 0;
+        int anchorCol = 0;
+        const char* line = nullptr;
+        int counts[27];
+        int tiles = 0;
+        char left[N + 1];
+        char word[N + 1];
+
+        void push(Kind kind, int col, Cursor arc, int depth) {
+            stack[top++] = Frame{arc, kind, (int8_t)col, (int8_t)depth, -1, -1, false};
+            prefetchNode(arc);
+        }
+
+        // Child of frame f through letter L (a frame that has no other child is replaced)
+        void descend(const Frame& f, char L, Cursor child) {
+            if (f.kind == Left) {
+                left[f.depth] = L;
+                push(Pivot, f.col, child, f.depth + 1);
+            } else {
+                word[f.depth] = L;
+                push(Right, f.col + 1, child, f.depth + 1);
+            }
+        }
+    };
+
+    template <int N>
+    template <typename Dict>
+    void BasicMoveGenerator<N>::advance(Lane<Dict>& lane, const Dict& dict, const uint32_t crossChecks[N][N],
+                                        std::vector<Move>& moves) const {
+        using Frame = typename Lane<Dict>::Frame;
+        typename Dict::Cursor child;
+        Frame& f = lane.stack[lane.top - 1];
+
+        // Back from a child: put its tile back on the rack
+        if (f.taken >= 0) {
+            lane.counts[f.taken]++;
+            lane.tiles++;
+            f.taken = -1;
+        }
+
+        if (f.kind == Lane<Dict>::Pivot) {
+            // As leftLetter: pivot to the right part if the path allows it, then go on left
+            Frame pivot = f;
+            bool right = dict.child(pivot.arc, GADDAG_DELIMITER, child);
+            if (right) SCRABBLE_COUNT(delimiterTransitions, 1);
+            right = right && (pivot.col == 0 || !lane.line[pivot.col - 1]);
+            if (pivot.col > 0) f = Frame{pivot.arc, Lane<Dict>::Left, (int8_t)(pivot.col - 1), pivot.depth, -1, -1, false};
+            else lane.top--;
+            if (right) {
+                for (int i = 0; i < pivot.depth; ++i) lane.word[i] = lane.left[pivot.depth - 1 - i];
+                lane.push(Lane<Dict>::Right, lane.anchorCol + 1, child, pivot.depth);
+            }
+            // Without a right part, the node is in cache: go on left in the same turn
+            if (right || pivot.col == 0) return;
+        }
 
-                if (rackTile == '?' || rackTile == '*') {
-                    for (char c = 'A'; c <= 'Z'; ++c) tryChar(c);
-                } else {
-                    tryChar(rackTile);
+        if (f.next < 0) {
+            SCRABBLE_COUNT(nodesVisited, 1);
+            char L;
+            if (f.kind == Lane<Dict>::Right) {
+                // As gen: record the word if it ends here, at the edge or before an empty square
+                L = f.col < N ? lane.line[f.col] : 0;
+                if (!L && dict.isTerminal(f.arc)) appendMove(moves, lane.row, lane.line, lane.word, f.col, f.depth);
+                if (f.col >= N) {
+                    lane.top--;
+                    return;
                 }
+            } else {
+                L = lane.line[f.col];
             }
-        } else {
-            char L = board.getTile(row, col).letter;
-            if (arc->children.count(L)) {
-                 processLetter(L, arc->children[L], rack);
+
+            if (L) {
+                // Occupied: the path must follow the tile on the board, and there is nothing else to try
+                SCRABBLE_COUNT(arcsTried, 1);
+                Frame tile = f;
+                lane.top--;
+                if (dict.child(tile.arc, L, child)) lane.descend(tile, L, child);
+                return;
+            }
+            if (lane.tiles == 0) {
+                lane.top--;
+                return;
+            }
+            f.blanks = lane.counts[26] > 0;
+            if (f.blanks) SCRABBLE_COUNT(blankExpansions, 1);
+            f.next = 0;
+        }
+
+        // As tryRack, one child per turn; with a blank, letters missing from the rack use it
+        uint32_t allowed = crossChecks[lane.row][f.col];
+        for (int l = f.next; l < 26; ++l) {
+            if (!f.blanks && lane.counts[l] == 0) continue;
+            char L = (char)('A' + l);
+            // Counted as tryRack does: each rack letter, or each existing edge with a blank
+            bool found = dict.child(f.arc, L, child);
+            if (found || !f.blanks) {
+                SCRABBLE_COUNT(rackAttempts, 1);
+                SCRABBLE_COUNT(arcsTried, 1);
+            }
+            if (!found) continue;
+            if (!((allowed >> l) & 1u)) {
+                SCRABBLE_COUNT(crossCheckRejects, 1);
+                continue;
             }
+            f.next = (int8_t)(l + 1);
+            f.taken = (int8_t)(lane.counts[l] > 0 ? l : 26);
+            lane.counts[f.taken]--;
+            lane.tiles--;
+            lane.descend(f, L, child);
+            return;
         }
+        lane.top--;
     }
 
-    void MoveGenerator::recordMove(const Board& board, int row, int col, const std::string& word, bool horizontal, std::vector<Move>& moves) const {
-        // 'col' is the position *after* the last letter.
-        int startCol = col - word.length();
-        
-        // Validation: Must have placed at least one tile.
-        bool placed = false;
-        int tileCount = 0;
-        Move m;
-        m.row = row;
-        m.col = startCol;
-        m.horizontal = horizontal;
-        m.word = word;
-        m.score = 0; 
-        
-        for (int i = 0; i < word.length(); ++i) {
-            if (board.isEmpty(row, startCol + i)) {
-                placed = true;
-                // Simplified: Assuming 1pt for now as placeholder for real tile score lookups
-                m.tiles[tileCount++] = Tile(word[i], 1); 
+    template <int N>
+    template <typename Dict>
+    void BasicMoveGenerator<N>::interleaveAnchors(const Board& board, const std::vector<char>& rack, const Dict& dict,
+                                                  const uint32_t crossChecks[N][N], const int* anchors, int anchorCount,
+                                                  std::vector<Move>& moves) const {
+        int counts[27];
+        int tiles = rackCounts(rack, counts);
+
+        char lines[N][N];
+        for (int r = 0; r < N; ++r) {
+            for (int c = 0; c < N; ++c) {
+                const Tile tile = board.getTile(r, c);
+                lines[r][c] = tile.isEmpty() ? 0 : tile.letter;
             }
         }
-        m.tileCount = tileCount;
 
-        if (placed) {
-            moves.push_back(m);
+        Lane<Dict> lanes[LANES];
+        int next = 0, active = 0;
+        auto start = [&](Lane<Dict>& lane) {
+            if (next == anchorCount) return false;
+            lane.row = anchors[next] / N;
+            lane.anchorCol = anchors[next] % N;
+            next++;
+            lane.line = lines[lane.row];
+            std::copy(counts, counts + 27, lane.counts);
+            lane.tiles = tiles;
+            lane.push(Lane<Dict>::Left, lane.anchorCol, dict.rootCursor(), 0);
+            return true;
+        };
+        for (Lane<Dict>& lane : lanes) {
+            if (start(lane)) active++;
+        }
+
+        // Round-robin over the lanes; a lane whose anchor is done takes the next one
+        while (active > 0) {
+            for (Lane<Dict>& lane : lanes) {
+                if (lane.top == 0) continue;
+                advance(lane, dict, crossChecks, moves);
+                if (lane.top == 0 && !start(lane)) active--;
+            }
         }
     }
 
+    template <int N>
+    void BasicMoveGenerator<N>::recordMove(int row, const char* line, const char* word, int col, int length,
+                                           std::vector<Move>& moves) const {
+        appendMove(moves, row, line, word, col, length);
+    }
+
+    // Supported board sizes
+    template struct BasicSquareMask<15>;
+    template struct BasicSquareMask<21>;
+    template class BasicMoveGenerator<15>;
+    template class BasicMoveGenerator<21>;
+
 }
@@ -6,37 +6,202 @@
 #include <vector>
 #include <string>
 #include <cstdint>
+#include <chrono>
+#include <type_traits>
 
 namespace Scrabble {
 
-    class MoveGenerator {
+    class SuccinctGaddag;
+    class LazyGaddag;
+
+    /**
+     * Set of board squares, one N-bit row mask per row (bit c = column c).
+     * Used to restrict generation to moves that reach given squares.
+     */
+    template <int N>
+    struct BasicSquareMask {
+        // One bit per column (or per row, for row masks)
+        using Row = typename std::conditional<(N <= 16), uint16_t, uint32_t>::type;
+        static const Row ALL = (Row)((1u << N) - 1);
+
+        Row rows[N] = {};
+
+        void set(int row, int col) { rows[row] |= (Row)(1u << col); }
+        bool test(int row, int col) const { return (rows[row] >> col) & 1u; }
+        bool empty() const;
+
+        /**
+         * Same squares with rows and columns swapped (for the vertical pass).
+         */
+        BasicSquareMask transposed() const;
+
+        /**
+         * Check whether any square of a row segment is in the mask.
+         * @param row Row index
+         * @param first First column (inclusive)
+         * @param last Last column (inclusive)
+         */
+        bool touches(int row, int first, int last) const;
+    };
+
+    using SquareMask = BasicSquareMask<15>;
+
+    /**
+     * Work limit for an interruptible search: a wall-clock deadline, a node count, or both.
+     * The traversal charges one unit per GADDAG node and reads the clock every
+     * CLOCK_INTERVAL nodes, so the overshoot past the deadline is a few microseconds.
+     */
+    struct SearchBudget {
+        static const uint64_t CLOCK_INTERVAL = 256;
+
+        std::chrono::steady_clock::time_point deadline;
+        bool hasDeadline = false;
+        uint64_t maxNodes = 0;      // 0 = no node limit
+        uint64_t nodes = 0;         // Nodes charged so far
+        bool expired = false;
+
+        SearchBudget() {}
+
+        /**
+         * Budget ending a duration from now.
+         * @param timeout Time allowed
+         */
+        static SearchBudget within(std::chrono::microseconds timeout);
+
+        /**
+         * Charge one node.
+         * @return true once the budget has run out (and from then on)
+         */
+        bool spend() {
+            if (expired) return true;
+            ++nodes;
+            if (maxNodes && nodes >= maxNodes) expired = true;
+            if (hasDeadline && nodes % CLOCK_INTERVAL == 0 && std::chrono::steady_clock::now() >= deadline) expired = true;
+            return expired;
+        }
+    };
+
+    /**
+     * Per-thread scratch space for move generation: cross-check table, anchor list,
+     * rack counts, word buffers and the output vector, all reused from call to call.
+     *
+     * Sharing rules: a loaded Gaddag is read-only and a MoveGenerator holds no
+     * state, so one of each can serve any number of threads. A GenContext is
+     * mutable and belongs to one thread at a time.
+     */
+    template <int N>
+    class BasicGenContext {
     private:
+        template <int> friend class BasicMoveGenerator;
+
+        uint32_t crossChecks[N][N];
+        int anchors[N * N];
+        int counts[27];     // Rack tiles by letter, blanks last
+        int tiles;          // Tiles left on the rack
+        char left[N + 1];   // GADDAG path of the left part (the word reversed)
+        char word[N + 1];   // Word being extended to the right
+        char line[N];       // Letters of the row being traversed, 0 for empty squares
+
+    public:
+        std::vector<Move> moves;    // Output of the last generateMoves call; capacity is kept
+
+        BasicGenContext() : tiles(0) {}
+    };
+
+    /**
+     * GADDAG move generator for an N x N board (Gordon's algorithm).
+     * Every board-sized table and loop bound is a constant of the instantiation;
+     * MoveGenerator.cpp instantiates the supported sizes (15 and 21).
+     */
+    template <int N>
+    class BasicMoveGenerator {
+    public:
+        using Board = BasicBoard<N>;
+        using SquareMask = BasicSquareMask<N>;
+        using GenContext = BasicGenContext<N>;
+        using RowMask = typename SquareMask::Row;
+
+    private:
+        // Reach of a word from each square of the masked rows, used to prune the traversal
+        struct MaskBounds;
+
+        // Inputs and scratch of one traversal over a dictionary (Gaddag, SuccinctGaddag or LazyGaddag)
+        template <typename Dict>
+        struct Traversal;
+
         // Helper to check if a square is an anchor
         bool isAnchor(const Board& board, int row, int col) const;
-        
-        // Helper to compute cross-checks (bitmask of valid letters for each square)
-        // Returns a 15x15 array where each entry is a bitmask (1 << (letter - 'A'))
-        // 0x3FFFFFF means all letters allowed.
-        void computeCrossChecks(const Board& board, const Gaddag& gaddag, uint32_t crossChecks[15][15]) const;
-
-        // Recursive generation function (Rightwards / Standard GoOn)
-        void gen(int row, int col, std::string word, const std::vector<char>& rack, 
-                 Node* arc, Node* oldArc, int direction, 
-                 const Board& board, const uint32_t crossChecks[15][15], 
-                 std::vector<Move>& moves) const;
-
-        // Recursive generation function (Leftwards for GADDAG)
-        void genLeft(int row, int col, std::string prefix, const std::vector<char>& rack, 
-                 Node* arc, int anchorRow, int anchorCol,
-                 const Board& board, const uint32_t crossChecks[15][15], 
-                 std::vector<Move>& moves) const;
-
-        // Add a valid move to the list
-        void recordMove(const Board& board, int row, int col, const std::string& word, bool horizontal, std::vector<Move>& moves) const;
+
+        // The traversal kernels are compiled once per combination of these flags, so the
+        // innermost recursion has no run-time test for them; traverseAnchors picks the
+        // kernel for each anchor.
+        enum KernelFlags : unsigned {
+            KernelBlanks = 1,       // The rack holds a blank
+            KernelRowTiles = 2,     // The anchor's row has tiles (otherwise every square is empty)
+            KernelMasked = 4,       // Restricted to a SquareMask (MaskBounds pruning)
+            KernelBudget = 8,       // Charged to a SearchBudget
+            KernelCount = 16
+        };
+
+        // Recursive generation function (Rightwards / Standard GoOn); the word so far is context.word[0..length)
+        template <typename Dict, unsigned Flags>
+        void gen(Traversal<Dict>& t, int col, typename Dict::Cursor arc, int length) const;
+
+        // Recursive generation function (Leftwards for GADDAG); the path so far is context.left[0..depth)
+        template <typename Dict, unsigned Flags>
+        void genLeft(Traversal<Dict>& t, int col, typename Dict::Cursor arc, int depth) const;
+
+        // Letter L placed or matched at col by the left part: pivot to the right part if the path allows it, then go on left
+        template <typename Dict, unsigned Flags>
+        void leftLetter(Traversal<Dict>& t, int col, char L, typename Dict::Cursor next, int depth) const;
+
+        // Calls next(letter, child) for each rack tile that fits an empty square, taking the tile off the rack meanwhile
+        template <typename Dict, unsigned Flags, typename Next>
+        void tryRack(Traversal<Dict>& t, int col, typename Dict::Cursor arc, Next next) const;
+
+        // Appends the move ending just before col, if it places at least one tile
+        template <typename Dict>
+        void record(Traversal<Dict>& t, int col, int length) const;
+
+        // Traversal from each anchor, optionally restricted to a mask (bounds may be null)
+        // Returns the number of anchors fully traversed before the budget (may be null) ran out
+        template <typename Dict>
+        int traverseAnchors(const Board& board, const std::vector<char>& rack, const Dict& dict,
+                            const uint32_t crossChecks[N][N], const int* anchors, int anchorCount,
+                            std::vector<Move>& moves, const MaskBounds* bounds, SearchBudget* budget,
+                            GenContext& context) const;
+
+        // Anchors kept in flight by the interleaved traversal
+        static const int LANES = 8;
+
+        // One anchor's traversal in the interleaved engine: the recursion of genLeft/gen
+        // as an explicit stack of frames, with its own rack counts and word buffers
+        template <typename Dict>
+        struct Lane;
+
+        // Run one frame of a lane: visit it, or move it on to its next child
+        template <typename Dict>
+        void advance(Lane<Dict>& lane, const Dict& dict, const uint32_t crossChecks[N][N],
+                     std::vector<Move>& moves) const;
+
+        // Traversal from each anchor, LANES anchors at a time, advanced in turn
+        template <typename Dict>
+        void interleaveAnchors(const Board& board, const std::vector<char>& rack, const Dict& dict,
+                               const uint32_t crossChecks[N][N], const int* anchors, int anchorCount,
+                               std::vector<Move>& moves) const;
+
+        // Cross-checks of the rows in rowMask, against either dictionary type
+        template <typename Dict>
+        void fillCrossChecks(const Board& board, const Dict& dict, uint32_t crossChecks[N][N], RowMask rowMask) const;
+
+        // Full generation into a context, against either dictionary type
+        template <typename Dict>
+        const std::vector<Move>& generate(const Board& board, const std::vector<char>& rack, const Dict& dict,
+                                          GenContext& context) const;
 
     public:
-        MoveGenerator();
-        ~MoveGenerator();
+        BasicMoveGenerator();
+        ~BasicMoveGenerator();
 
         /**
          * Generate all legal moves for a given board and rack.
@@ -46,8 +211,148 @@ namespace Scrabble {
          * @return A vector of valid moves.
          */
         std::vector<Move> generateMoves(const Board& board, const std::vector<char>& rack, const Gaddag& gaddag) const;
+
+        /**
+         * Same, using a caller-owned context for all scratch memory.
+         * @param context Scratch of the calling thread
+         * @return context.moves, valid until the next call with this context
+         */
+        const std::vector<Move>& generateMoves(const Board& board, const std::vector<char>& rack, const Gaddag& gaddag,
+                                               GenContext& context) const;
+
+        /**
+         * Same moves (in another order) from the interleaved traversal: several anchors are
+         * in flight at once, each as an explicit stack of frames, and the stacks are advanced
+         * in turn. A node is prefetched when its frame is pushed and read when its lane comes
+         * round again, so the cache misses of different anchors overlap instead of stalling
+         * one after the other.
+         * @param gaddag The dictionary.
+         */
+        std::vector<Move> generateMovesInterleaved(const Board& board, const std::vector<char>& rack,
+                                                   const Gaddag& gaddag) const;
+
+        const std::vector<Move>& generateMovesInterleaved(const Board& board, const std::vector<char>& rack,
+                                                          const Gaddag& gaddag, GenContext& context) const;
+
+        /**
+         * Same moves, read from a succinct GADDAG of the same lexicon (in another order).
+         * @param dictionary The dictionary.
+         */
+        std::vector<Move> generateMoves(const Board& board, const std::vector<char>& rack,
+                                        const SuccinctGaddag& dictionary) const;
+
+        const std::vector<Move>& generateMoves(const Board& board, const std::vector<char>& rack,
+                                               const SuccinctGaddag& dictionary, GenContext& context) const;
+
+        /**
+         * Same moves, from a dictionary still loading: the pages the traversal needs are
+         * loaded on the way. Once it is warm, its complete Gaddag is used instead.
+         * @param dictionary The dictionary.
+         */
+        std::vector<Move> generateMoves(const Board& board, const std::vector<char>& rack,
+                                        const LazyGaddag& dictionary) const;
+
+        const std::vector<Move>& generateMoves(const Board& board, const std::vector<char>& rack,
+                                               const LazyGaddag& dictionary, GenContext& context) const;
+
+        /**
+         * Generate the horizontal moves whose word covers at least one square of a mask.
+         * Only the masked rows get cross-checks and anchors, and branches whose
+         * reachable span cannot touch the mask are pruned.
+         * @param board The current game board.
+         * @param rack The player's current rack.
+         * @param gaddag The dictionary.
+         * @param mask Squares the word must cover.
+         * @return The moves of generateMoves(board, rack, gaddag) that touch the mask.
+         */
+        std::vector<Move> generateMoves(const Board& board, const std::vector<char>& rack, const Gaddag& gaddag,
+                                        const SquareMask& mask) const;
+
+        /**
+         * Compute cross-checks for horizontal play (bitmask of valid letters for each square).
+         * Each entry is a bitmask (1 << (letter - 'A')); 0x3FFFFFF means all letters allowed.
+         * Occupied squares get the full mask. Use the transposed board for vertical play.
+         * @param board The current game board.
+         * @param gaddag The dictionary.
+         * @param crossChecks Output N x N array.
+         */
+        void computeCrossChecks(const Board& board, const Gaddag& gaddag, uint32_t crossChecks[N][N]) const;
+
+        /**
+         * Same, for the rows set in an N-bit row mask only (other rows are left untouched).
+         */
+        void computeCrossChecks(const Board& board, const Gaddag& gaddag, uint32_t crossChecks[N][N],
+                                RowMask rowMask) const;
+
+        /**
+         * Same, from a succinct GADDAG.
+         */
+        void computeCrossChecks(const Board& board, const SuccinctGaddag& dictionary, uint32_t crossChecks[N][N]) const;
+
+        /**
+         * Cross-checks of the squares of one column, which depend only on that column's tiles.
+         * @param board The current game board.
+         * @param gaddag The dictionary.
+         * @param col Column index.
+         * @param checks Output, checks[row] as in computeCrossChecks.
+         */
+        void computeColumnCrossChecks(const Board& board, const Gaddag& gaddag, int col, uint32_t checks[N]) const;
+
+        // The stages below make up generateMoves; they are public so benchmarks can time each one.
+
+        /**
+         * List the anchor squares for horizontal play, in row-major order.
+         * @param board The current game board.
+         * @param anchors Output, row * N + col for each anchor (N * N entries max).
+         * @return Number of anchors written.
+         */
+        int findAnchors(const Board& board, int anchors[N * N]) const;
+
+        /**
+         * Run the GADDAG traversal (genLeft/gen) from each anchor and record the moves found.
+         * @param board The current game board.
+         * @param rack The player's rack.
+         * @param gaddag The dictionary.
+         * @param crossChecks Cross-checks from computeCrossChecks.
+         * @param anchors Anchors from findAnchors.
+         * @param anchorCount Number of anchors.
+         * @param moves Output, moves are appended.
+         */
+        void generateFromAnchors(const Board& board, const std::vector<char>& rack, const Gaddag& gaddag,
+                                 const uint32_t crossChecks[N][N], const int* anchors, int anchorCount,
+                                 std::vector<Move>& moves) const;
+
+        /**
+         * Same traversal, stopping when a budget runs out. Moves found before that
+         * are kept, so anchors should be passed most promising first.
+         * @param budget Search budget, charged as the traversal goes
+         * @return Number of anchors fully traversed (anchorCount when the search completed)
+         */
+        int generateFromAnchors(const Board& board, const std::vector<char>& rack, const Gaddag& gaddag,
+                                const uint32_t crossChecks[N][N], const int* anchors, int anchorCount,
+                                std::vector<Move>& moves, SearchBudget& budget) const;
+
+        /**
+         * Append the horizontal move of word[0..length) ending just before col, as the
+         * traversal records it, if it places at least one tile.
+         * @param row Row of the word.
+         * @param line The row's letters, 0 for an empty square.
+         * @param word Letters of the move.
+         * @param col Column after the last letter.
+         * @param length Length of the word.
+         * @param moves Output list.
+         */
+        void recordMove(int row, const char* line, const char* word, int col, int length,
+                        std::vector<Move>& moves) const;
     };
 
+    // The standard 15x15 generator and its scratch, used by everything that does not name a size
+    using MoveGenerator = BasicMoveGenerator<15>;
+    using GenContext = BasicGenContext<15>;
+
+    // The 21x21 generator of the Super variant
+    using SuperMoveGenerator = BasicMoveGenerator<21>;
+
 }
 
 #endif // MOVE_GENERATOR_H
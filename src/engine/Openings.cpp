@@ -0,0 +1,361 @@
+#include "Openings.h"
+#include "MoveGenerator.h"
+#include "Rules.h"
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <thread>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace Scrabble {
+
+    static const char OPENING_MAGIC[8] = {'S', 'C', 'R', 'B', 'O', 'P', '0', '1'};
+    static const int SYMBOLS = 27;  // A-Z, then the blank
+    static const int CENTER_ROW = 7;
+
+    struct OpeningHeader {
+        char magic[8];
+        uint32_t version;
+        uint32_t perRack;
+        uint32_t slots;
+        uint32_t lexiconWords;
+        uint64_t moveCount;
+        uint64_t lexiconHash;
+        uint64_t reserved;
+    };
+
+    static_assert(sizeof(OpeningHeader) == 48, "OpeningHeader layout");
+
+    // Words are the paths REV(word)+ ending on a terminal node; below the delimiter there are none
+    static void fingerprintWords(Gaddag::Cursor node, std::string& reversed, uint32_t& words, uint64_t& hash) {
+        Gaddag::Cursor end;
+        if (Gaddag::child(node, GADDAG_DELIMITER, end) && Gaddag::isTerminal(end)) {
+            uint64_t h = 0xCBF29CE484222325ULL;  // FNV-1a of the word, then a finalizer
+            for (auto it = reversed.rbegin(); it != reversed.rend(); ++it) h = (h ^ (uint8_t)*it) * 0x100000001B3ULL;
+            h = (h ^ (h >> 33)) * 0xFF51AFD7ED558CCDULL;
+            h = (h ^ (h >> 33)) * 0xC4CEB9FE1A85EC53ULL;
+            hash += h ^ (h >> 33);  // A sum does not depend on the order children are visited in
+            words++;
+        }
+        Gaddag::forEachChild(node, [&](char letter, Gaddag::Cursor next) {
+            if (letter == GADDAG_DELIMITER) return;
+            reversed.push_back(letter);
+            fingerprintWords(next, reversed, words, hash);
+            reversed.pop_back();
+        });
+    }
+
+    // Identifies the word list a table was built from
+    static void lexiconFingerprint(const Gaddag& gaddag, uint32_t& words, uint64_t& hash) {
+        std::string reversed;
+        words = 0;
+        hash = 0;
+        fingerprintWords(gaddag.rootCursor(), reversed, words, hash);
+    }
+
+    /*
+     * Packed move (uint64):
+     *   bits 0-3    start column          bits 4-6    length (2-7)
+     *   bits 7-13   blank mask by letter  bits 14-48  letters, 5 bits each (letter - 'A')
+     *   bits 49-58  score
+     */
+
+    static uint64_t packMove(const Move& m) {
+        uint64_t packed = (uint64_t)m.col | ((uint64_t)m.word.length() << 4);
+        for (size_t i = 0; i < m.word.length(); ++i) {
+            if (m.tiles[i].isBlank()) packed |= 1ULL << (7 + i);
+            packed |= (uint64_t)(m.word[i] - 'A') << (14 + 5 * i);
+        }
+        return packed | ((uint64_t)std::min(m.score, 1023) << 49);
+    }
+
+    static Move unpackMove(uint64_t packed) {
+        Move m;
+        m.row = CENTER_ROW;
+        m.col = (int)(packed & 0xF);
+        m.horizontal = true;
+        int length = (int)((packed >> 4) & 0x7);
+        for (int i = 0; i < length; ++i) {
+            char letter = (char)('A' + ((packed >> (14 + 5 * i)) & 0x1F));
+            bool blank = (packed >> (7 + i)) & 1;
+            m.word += letter;
+            m.tiles[i] = Tile(letter, blank ? 0 : letterValue(letter));
+        }
+        m.tileCount = length;
+        m.score = (int)((packed >> 49) & 0x3FF);
+        return m;
+    }
+
+    static uint32_t binomial(int n, int k) {
+        if (k < 0 || k > n) return 0;
+        uint64_t r = 1;
+        for (int i = 1; i <= k; ++i) r = r * (uint64_t)(n - k + i) / (uint64_t)i;
+        return (uint32_t)r;
+    }
+
+    bool rackRank(const std::vector<char>& rack, uint32_t& rank) {
+        if (rack.size() != (size_t)RACK_SIZE) return false;
+        int symbols[RACK_SIZE];
+        for (int i = 0; i < RACK_SIZE; ++i) {
+            char c = rack[i];
+            if (isBlankTile(c)) {
+                symbols[i] = SYMBOLS - 1;
+            } else if (std::isalpha((unsigned char)c)) {
+                symbols[i] = std::toupper((unsigned char)c) - 'A';
+            } else {
+                return false;
+            }
+        }
+        std::sort(symbols, symbols + RACK_SIZE);
+
+        // Combinatorial number system: sorted multiset -> strictly increasing sequence
+        rank = 0;
+        for (int i = 0; i < RACK_SIZE; ++i) rank += binomial(symbols[i] + i, i + 1);
+        return true;
+    }
+
+    static void enumerateRacks(int symbol, int blanksLeft, std::vector<char>& rack,
+                               const std::function<void(const std::vector<char>&)>& visit) {
+        if (rack.size() == (size_t)RACK_SIZE) {
+            visit(rack);
+            return;
+        }
+        if (symbol == SYMBOLS) return;
+        char c = symbol == SYMBOLS - 1 ? BLANK_TILE : (char)('A' + symbol);
+        int most = std::min(letterCount(c), RACK_SIZE - (int)rack.size());
+        if (c == BLANK_TILE) most = std::min(most, blanksLeft);
+        for (int n = 0; n <= most; ++n) {
+            enumerateRacks(symbol + 1, blanksLeft, rack, visit);
+            rack.push_back(c);
+        }
+        rack.resize(rack.size() - (most + 1));
+    }
+
+    void forEachOpeningRack(int maxBlanks, const std::function<void(const std::vector<char>&)>& visit) {
+        std::vector<char> rack;
+        enumerateRacks(0, maxBlanks, rack, visit);
+    }
+
+    // Best horizontal openings for one rack, packed, best first
+    static std::vector<uint64_t> bestOpenings(const Board& empty, const std::vector<char>& rack,
+                                              const MoveGenerator& generator, const Gaddag& gaddag, int keep) {
+        std::vector<Move> moves = generator.generateMoves(empty, rack, gaddag);
+        std::sort(moves.begin(), moves.end(), [](const Move& a, const Move& b) {
+            return a.col != b.col ? a.col < b.col : a.word < b.word;
+        });
+        moves.erase(std::unique(moves.begin(), moves.end(), [](const Move& a, const Move& b) {
+            return a.col == b.col && a.word == b.word;
+        }), moves.end());
+        for (Move& m : moves) {
+            resolveAndScore(empty, m, rack);
+        }
+
+        // Ties keep the leftmost column first, as the generator's move order does
+        std::stable_sort(moves.begin(), moves.end(), [](const Move& a, const Move& b) { return a.score > b.score; });
+        if ((int)moves.size() > keep) moves.resize(keep);
+
+        std::vector<uint64_t> packed;
+        for (const Move& m : moves) packed.push_back(packMove(m));
+        return packed;
+    }
+
+    bool buildOpeningTable(const Gaddag& gaddag, const std::string& path, const OpeningBuildConfig& config,
+                           const std::function<void(size_t, size_t)>& progress) {
+        std::vector<std::vector<char>> racks;
+        if (config.racks.empty()) {
+            forEachOpeningRack(config.maxBlanks, [&](const std::vector<char>& rack) { racks.push_back(rack); });
+        } else {
+            // One entry per slot: the listed racks may repeat or differ only in order
+            std::vector<bool> listed(OPENING_SLOTS, false);
+            for (const std::string& text : config.racks) {
+                std::vector<char> rack(text.begin(), text.end());
+                uint32_t rank;
+                if (!rackRank(rack, rank)) {
+                    std::cerr << "Not a 7-tile rack: " << text << std::endl;
+                    return false;
+                }
+                if (listed[rank]) continue;
+                listed[rank] = true;
+                for (char& c : rack) c = isBlankTile(c) ? BLANK_TILE : (char)std::toupper((unsigned char)c);
+                racks.push_back(rack);
+            }
+        }
+
+        int keep = std::max(1, std::min(config.movesPerRack, 255));
+        std::vector<std::vector<uint64_t>> results(racks.size());
+        std::atomic<size_t> next(0), done(0);
+        Board empty;
+        auto worker = [&](bool reports) {
+            MoveGenerator generator;
+            size_t i;
+            while ((i = next++) < racks.size()) {
+                results[i] = bestOpenings(empty, racks[i], generator, gaddag, keep);
+                size_t finished = ++done;
+                if (reports && progress && finished % 10000 == 0) progress(finished, racks.size());
+            }
+        };
+        int threadCount = std::max(1, config.threads);
+        std::vector<std::thread> threads;
+        for (int t = 1; t < threadCount; ++t) threads.emplace_back(worker, false);
+        worker(true);
+        for (std::thread& t : threads) t.join();
+        if (progress) progress(racks.size(), racks.size());
+
+        // Slot -> rack index
+        std::vector<int32_t> bySlot(OPENING_SLOTS, -1);
+        uint64_t moveCount = 0;
+        for (size_t i = 0; i < racks.size(); ++i) {
+            uint32_t rank;
+            rackRank(racks[i], rank);
+            bySlot[rank] = (int32_t)i;
+            moveCount += results[i].size();
+        }
+
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        if (!out.is_open()) {
+            std::cerr << "Error opening opening table for writing: " << path << std::endl;
+            return false;
+        }
+        OpeningHeader header;
+        std::memcpy(header.magic, OPENING_MAGIC, sizeof(header.magic));
+        header.version = OPENING_VERSION;
+        header.perRack = (uint32_t)keep;
+        header.slots = OPENING_SLOTS;
+        header.moveCount = moveCount;
+        header.reserved = 0;
+        lexiconFingerprint(gaddag, header.lexiconWords, header.lexiconHash);
+        out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+        std::vector<uint32_t> offsets(OPENING_SLOTS + 1);
+        uint32_t offset = 0;
+        for (uint32_t s = 0; s < OPENING_SLOTS; ++s) {
+            offsets[s] = offset;
+            if (bySlot[s] >= 0) offset += (uint32_t)results[bySlot[s]].size();
+        }
+        offsets[OPENING_SLOTS] = offset;
+        out.write(reinterpret_cast<const char*>(offsets.data()), offsets.size() * sizeof(uint32_t));
+        for (uint32_t s = 0; s < OPENING_SLOTS; ++s) {
+            if (bySlot[s] < 0) continue;
+            const std::vector<uint64_t>& moves = results[bySlot[s]];
+            out.write(reinterpret_cast<const char*>(moves.data()), moves.size() * sizeof(uint64_t));
+        }
+        return out.good();
+    }
+
+    OpeningTable::OpeningTable() : base(nullptr), length(0), offsets(nullptr), entries(nullptr), perRack(0) {}
+
+    OpeningTable::~OpeningTable() {
+        close();
+    }
+
+    bool OpeningTable::open(const std::string& path, const Gaddag& gaddag) {
+        close();
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) {
+            std::cerr << "Error opening opening table: " << path << std::endl;
+            return false;
+        }
+        struct stat st;
+        size_t indexBytes = sizeof(OpeningHeader) + (OPENING_SLOTS + 1) * sizeof(uint32_t);
+        if (fstat(fd, &st) != 0 || (size_t)st.st_size < indexBytes) {
+            ::close(fd);
+            std::cerr << "Invalid opening table: " << path << std::endl;
+            return false;
+        }
+        void* map = mmap(nullptr, (size_t)st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+        ::close(fd);
+        if (map == MAP_FAILED) {
+            std::cerr << "Error mapping opening table: " << path << std::endl;
+            return false;
+        }
+
+        const OpeningHeader* header = static_cast<const OpeningHeader*>(map);
+        const uint32_t* slots = reinterpret_cast<const uint32_t*>(static_cast<const uint8_t*>(map) + sizeof(OpeningHeader));
+        bool valid = std::memcmp(header->magic, OPENING_MAGIC, sizeof(header->magic)) == 0 &&
+                     header->version == OPENING_VERSION && header->slots == OPENING_SLOTS &&
+                     header->perRack >= 1 && header->perRack <= 255 &&
+                     header->moveCount <= ((size_t)st.st_size - indexBytes) / sizeof(uint64_t) &&
+                     (size_t)st.st_size == indexBytes + header->moveCount * sizeof(uint64_t);
+
+        // lookup() reads entries[offsets[rank], offsets[rank + 1]) without further checks
+        valid = valid && slots[0] == 0 && slots[OPENING_SLOTS] == header->moveCount;
+        for (uint32_t s = 0; valid && s < OPENING_SLOTS; ++s) {
+            valid = slots[s] <= slots[s + 1] && slots[s + 1] - slots[s] <= header->perRack;
+        }
+        if (!valid) {
+            munmap(map, (size_t)st.st_size);
+            std::cerr << "Invalid opening table: " << path << std::endl;
+            return false;
+        }
+
+        uint32_t words;
+        uint64_t hash;
+        lexiconFingerprint(gaddag, words, hash);
+        if (words != header->lexiconWords || hash != header->lexiconHash) {
+            munmap(map, (size_t)st.st_size);
+            std::cerr << "Opening table was built from another dictionary: " << path << std::endl;
+            return false;
+        }
+
+        base = static_cast<const uint8_t*>(map);
+        length = (size_t)st.st_size;
+        offsets = slots;
+        entries = reinterpret_cast<const uint64_t*>(base + indexBytes);
+        perRack = header->perRack;
+        return true;
+    }
+
+    void OpeningTable::close() {
+        if (base) munmap(const_cast<uint8_t*>(base), length);
+        base = nullptr;
+        length = 0;
+        offsets = nullptr;
+        entries = nullptr;
+        perRack = 0;
+    }
+
+    bool OpeningTable::lookup(const std::vector<char>& rack, std::vector<Move>& moves) const {
+        uint32_t rank;
+        if (!base || !rackRank(rack, rank)) return false;
+        uint32_t first = offsets[rank], last = offsets[rank + 1];
+        if (first == last) return false;
+
+        moves.clear();
+        for (uint32_t i = first; i < last; ++i) {
+            Move h = unpackMove(entries[i]);
+            // A damaged entry would place tiles off the board: generate instead
+            if (h.tileCount < 2 || h.col + h.tileCount > 15 ||
+                std::any_of(h.word.begin(), h.word.end(), [](char c) { return c > 'Z'; })) {
+                moves.clear();
+                return false;
+            }
+            Move v = h;
+            std::swap(v.row, v.col);
+            v.horizontal = false;
+            moves.push_back(h);
+            moves.push_back(v);
+        }
+        std::sort(moves.begin(), moves.end(), [](const Move& a, const Move& b) {
+            if (a.row != b.row) return a.row < b.row;
+            if (a.col != b.col) return a.col < b.col;
+            if (a.horizontal != b.horizontal) return a.horizontal < b.horizontal;
+            return a.word < b.word;
+        });
+        return true;
+    }
+
+    bool isBoardEmpty(const Board& board) {
+        const Tile* tiles = board.tileData();
+        for (int i = 0; i < 225; ++i) {
+            if (!tiles[i].isEmpty()) return false;
+        }
+        return true;
+    }
+
+}
@@ -0,0 +1,112 @@
+#ifndef OPENINGS_H
+#define OPENINGS_H
+
+#include "engine.h"
+#include "Gaddag.h"
+#include <vector>
+#include <string>
+#include <cstdint>
+#include <functional>
+
+namespace Scrabble {
+
+    /*
+     * Opening-move table: the best moves on an empty board for every 7-tile rack,
+     * built offline and memory-mapped at run time.
+     *
+     * On an empty board the moves depend only on the rack, and vertical moves are
+     * the horizontal ones transposed, so only horizontal moves on the centre row
+     * are stored. A rack is located by its rank among all 7-element multisets of
+     * 27 symbols (A-Z, blank): a perfect hash into C(33, 7) slots.
+     *
+     * File layout (little-endian):
+     *   OpeningHeader (48)                 magic "SCRBOP01", version, moves per rack, slot count,
+     *                                      move count, word count and hash of the lexicon
+     *   uint32 offsets[slots + 1]          first move of each rack slot
+     *   uint64 moves[count]                packed moves (see Openings.cpp), best first
+     */
+
+    const uint32_t OPENING_VERSION = 2;
+    const uint32_t OPENING_SLOTS = 4272048;  // C(33, 7): multisets of 7 tiles over A-Z and the blank
+
+    /**
+     * Perfect hash of a 7-tile rack.
+     * @param rack Letters (upper or lower case) and blanks ('?' or '*')
+     * @param rank Output, in [0, OPENING_SLOTS)
+     * @return false if the rack does not hold exactly 7 valid tiles
+     */
+    bool rackRank(const std::vector<char>& rack, uint32_t& rank);
+
+    /**
+     * Every distinct 7-tile rack that the French tile set can deal, in rank order
+     * of the letters ('?' for blanks).
+     * @param maxBlanks Skip racks with more blanks than this
+     * @param visit Called once per rack
+     */
+    void forEachOpeningRack(int maxBlanks, const std::function<void(const std::vector<char>&)>& visit);
+
+    struct OpeningBuildConfig {
+        int movesPerRack = 4;
+        int threads = 1;
+        int maxBlanks = 2;
+        std::vector<std::string> racks;   // Build only these racks (empty = all); others fall back to generation
+    };
+
+    /**
+     * Generate the opening table for every rack and write it.
+     * @param gaddag Dictionary
+     * @param path Output file
+     * @param config Moves kept per rack, threads, blank limit and rack subset
+     * @param progress Optional, called with (racks done, racks total) from the calling thread
+     * @return false on I/O error or if a listed rack is not a 7-tile rack
+     */
+    bool buildOpeningTable(const Gaddag& gaddag, const std::string& path, const OpeningBuildConfig& config,
+                           const std::function<void(size_t, size_t)>& progress = nullptr);
+
+    /**
+     * Read-only, memory-mapped opening table. Safe to share between threads.
+     */
+    class OpeningTable {
+    private:
+        const uint8_t* base;
+        size_t length;
+        const uint32_t* offsets;
+        const uint64_t* entries;
+        uint32_t perRack;
+
+    public:
+        OpeningTable();
+        ~OpeningTable();
+        OpeningTable(const OpeningTable&) = delete;
+        OpeningTable& operator=(const OpeningTable&) = delete;
+
+        /**
+         * Map a table and check it: the index must address only stored moves, and the
+         * table must have been built from the same word list as the dictionary.
+         * @param path Table written by buildOpeningTable
+         * @param gaddag Dictionary the moves will be played with
+         * @return false if the file is missing, malformed or built from another lexicon
+         */
+        bool open(const std::string& path, const Gaddag& gaddag);
+        void close();
+        bool isOpen() const { return base != nullptr; }
+        uint32_t movesPerRack() const { return perRack; }
+
+        /**
+         * Best opening moves for a rack, in both directions, scored and with
+         * resolved tiles, in the order generateScoredMoves would list them.
+         * @param rack A 7-tile rack
+         * @param moves Output (replaced)
+         * @return false if the rack is not in the table (caller should generate)
+         */
+        bool lookup(const std::vector<char>& rack, std::vector<Move>& moves) const;
+    };
+
+    /**
+     * Check whether no tile has been played yet.
+     */
+    bool isBoardEmpty(const Board& board);
+
+}
+
+#endif // OPENINGS_H
@@ -0,0 +1,227 @@
+#include "Pattern.h"
+#include "Rules.h"
+#include <algorithm>
+#include <cctype>
+#include <unordered_set>
+
+namespace Scrabble {
+
+    static const uint32_t ALL_LETTERS = 0x3FFFFFF;
+
+    bool parsePattern(const std::string& pattern, std::vector<PatternToken>& tokens, std::string& error) {
+        tokens.clear();
+        for (size_t i = 0; i < pattern.length(); ++i) {
+            char c = (char)std::toupper((unsigned char)pattern[i]);
+            if (c >= 'A' && c <= 'Z') {
+                tokens.push_back({1u << (c - 'A'), false});
+            } else if (c == '?') {
+                tokens.push_back({ALL_LETTERS, false});
+            } else if (c == '*') {
+                // Consecutive stars match the same words as one
+                if (tokens.empty() || !tokens.back().repeat) tokens.push_back({ALL_LETTERS, true});
+            } else if (c == '[') {
+                size_t close = pattern.find(']', i);
+                if (close == std::string::npos) {
+                    error = "unclosed letter class";
+                    return false;
+                }
+                size_t first = i + 1;
+                bool negate = first < close && pattern[first] == '^';
+                if (negate) first++;
+                uint32_t letters = 0;
+                for (size_t j = first; j < close; ++j) {
+                    char l = (char)std::toupper((unsigned char)pattern[j]);
+                    if (l < 'A' || l > 'Z') {
+                        error = std::string("bad letter in class: ") + pattern[j];
+                        return false;
+                    }
+                    letters |= 1u << (l - 'A');
+                }
+                if (negate) letters = ALL_LETTERS & ~letters;
+                if (letters == 0) {
+                    error = "empty letter class";
+                    return false;
+                }
+                tokens.push_back({letters, false});
+                i = close;
+            } else {
+                error = std::string("unexpected character: ") + pattern[i];
+                return false;
+            }
+        }
+        if (tokens.empty()) {
+            error = "empty pattern";
+            return false;
+        }
+        return true;
+    }
+
+    // Rough rarity of a token: allowed letters first, then how common they are in the tile set
+    static int selectivity(const PatternToken& token) {
+        int letters = 0, tiles = 0;
+        for (int l = 0; l < 26; ++l) {
+            if (!((token.letters >> l) & 1u)) continue;
+            letters++;
+            tiles += letterCount((char)('A' + l));
+        }
+        return letters * 1000 + tiles;
+    }
+
+    static uint32_t letterMask(const std::string& letters) {
+        uint32_t mask = 0;
+        for (char c : letters) {
+            char l = (char)std::toupper((unsigned char)c);
+            if (l >= 'A' && l <= 'Z') mask |= 1u << (l - 'A');
+        }
+        return mask;
+    }
+
+    struct PatternSearch {
+        std::vector<PatternToken> tokens;
+        const PatternQuery& query;
+        const std::function<void(const std::string&)>& onMatch;
+        uint32_t excluded;
+        int required[26];
+        int anchor;
+        char path[16];     // Left part reversed, then the right part
+        int split;         // Length of the left part (anchor included)
+        size_t found;
+        bool dedup;
+        std::unordered_set<std::string> seen;
+
+        PatternSearch(const std::vector<PatternToken>& t, const PatternQuery& q,
+                      const std::function<void(const std::string&)>& callback)
+            : tokens(t), query(q), onMatch(callback), excluded(letterMask(q.exclude)), required(), anchor(0),
+              split(0), found(0), dedup(false) {
+            for (char c : q.include) {
+                char l = (char)std::toupper((unsigned char)c);
+                if (l >= 'A' && l <= 'Z') required[l - 'A']++;
+            }
+        }
+
+        bool done() const { return query.limit > 0 && found >= query.limit; }
+
+        // The path pivoting on the anchor starts with the anchor's letter
+        void run(const Node* root) {
+            each(root, tokens[anchor].letters, 0, [&](const Node* child, int depth) { left(child, anchor - 1, depth); });
+        }
+
+        void emit(int depth) {
+            if (depth < query.minLength) return;
+            std::string word(depth, ' ');
+            for (int i = 0; i < split; ++i) word[i] = path[split - 1 - i];
+            for (int i = split; i < depth; ++i) word[i] = path[i];
+
+            int counts[26] = {};
+            for (char c : word) counts[c - 'A']++;
+            for (int l = 0; l < 26; ++l) {
+                if (counts[l] < required[l]) return;
+            }
+            if (dedup && !seen.insert(word).second) return;
+            found++;
+            onMatch(word);
+        }
+
+        // Follows every child allowed by a token's letters
+        template <typename Next>
+        void each(const Node* node, uint32_t letters, int depth, Next next) {
+            if (depth >= query.maxLength || depth >= (int)sizeof(path)) return;
+            letters &= ~excluded;
+            for (const auto& child : node->children) {
+                char c = child.first;
+                if (c < 'A' || c > 'Z' || !((letters >> (c - 'A')) & 1u)) continue;
+                path[depth] = c;
+                next(child.second, depth + 1);
+                if (done()) return;
+            }
+        }
+
+        // Tokens left of the anchor, matched right to left
+        void left(const Node* node, int token, int depth) {
+            if (done()) return;
+            if (token < 0) {
+                auto delimiter = node->children.find(GADDAG_DELIMITER);
+                if (delimiter == node->children.end()) return;
+                split = depth;
+                right(delimiter->second, anchor + 1, depth);
+                return;
+            }
+            const PatternToken& t = tokens[token];
+            if (t.repeat) {
+                left(node, token - 1, depth);
+                each(node, t.letters, depth, [&](const Node* child, int d) { left(child, token, d); });
+            } else {
+                each(node, t.letters, depth, [&](const Node* child, int d) { left(child, token - 1, d); });
+            }
+        }
+
+        // Tokens right of the anchor, matched left to right
+        void right(const Node* node, int token, int depth) {
+            if (done()) return;
+            if (token == (int)tokens.size()) {
+                if (node->isTerminal) emit(depth);
+                return;
+            }
+            const PatternToken& t = tokens[token];
+            if (t.repeat) {
+                right(node, token + 1, depth);
+                each(node, t.letters, depth, [&](const Node* child, int d) { right(child, token, d); });
+            } else {
+                each(node, t.letters, depth, [&](const Node* child, int d) { right(child, token + 1, d); });
+            }
+        }
+    };
+
+    bool searchPattern(const Gaddag& gaddag, const PatternQuery& query,
+                       const std::function<void(const std::string&)>& onMatch, std::string& error) {
+        std::vector<PatternToken> tokens;
+        if (!parsePattern(query.pattern, tokens, error)) return false;
+
+        PatternSearch search(tokens, query, onMatch);
+        int best = -1;
+        for (int i = 0; i < (int)tokens.size(); ++i) {
+            if (tokens[i].repeat) continue;
+            if (best < 0 || selectivity(tokens[i]) < selectivity(tokens[best])) best = i;
+        }
+        // With a star, one word can match the pattern in more than one alignment
+        search.dedup = std::any_of(tokens.begin(), tokens.end(), [](const PatternToken& t) { return t.repeat; });
+
+        // Rarest required letter: when no token fixes a letter, pivoting on it beats walking every word
+        int rare = -1;
+        for (int l = 0; l < 26; ++l) {
+            if (search.required[l] && (rare < 0 || letterCount((char)('A' + l)) < letterCount((char)('A' + rare)))) rare = l;
+        }
+        bool pivotOnRequired = rare >= 0 && (best < 0 || (__builtin_popcount(tokens[best].letters) > 1 &&
+                               selectivity(PatternToken{1u << rare, false}) < selectivity(tokens[best])));
+
+        if (!pivotOnRequired) {
+            // A pattern of stars alone matches any word: give it one letter to pivot on
+            if (best < 0) {
+                search.tokens.insert(search.tokens.begin(), PatternToken{ALL_LETTERS, false});
+                best = 0;
+            }
+            search.anchor = best;
+            search.run(gaddag.getRoot());
+            return true;
+        }
+
+        // Every match holds the letter somewhere: pivot on it at each token that can hold it,
+        // a star standing for "*L*". A word holding it twice is found from both positions.
+        search.dedup = true;
+        uint32_t letter = 1u << rare;
+        for (int i = 0; i < (int)tokens.size() && !search.done(); ++i) {
+            if (!(tokens[i].letters & letter)) continue;
+            search.tokens = tokens;
+            search.anchor = i;
+            if (tokens[i].repeat) {
+                search.tokens.insert(search.tokens.begin() + i + 1, {PatternToken{letter, false}, tokens[i]});
+                search.anchor = i + 1;
+            } else {
+                search.tokens[i].letters = letter;
+            }
+            search.run(gaddag.getRoot());
+        }
+        return true;
+    }
+
+}
@@ -0,0 +1,69 @@
+#ifndef PATTERN_H
+#define PATTERN_H
+
+#include "Gaddag.h"
+#include <vector>
+#include <string>
+#include <functional>
+#include <cstdint>
+
+namespace Scrabble {
+
+    /*
+     * Pattern search over the lexicon.
+     *
+     * Pattern syntax (case-insensitive):
+     *   A-Z      that letter
+     *   ?        any one letter
+     *   *        any run of letters, possibly empty
+     *   [AEIOU]  one letter of the class; [^QU] one letter outside it
+     *
+     * A board row such as ". . A . . E" is written ??A??E, or *A??E* when the word
+     * may extend past the known squares.
+     *
+     * The search starts from the most selective single-letter token (the rarest
+     * fixed letter if there is one) using the GADDAG path that pivots on it, walks
+     * the tokens to its left backwards, crosses the delimiter, then walks the
+     * tokens to its right. Excluded letters are pruned during the walk.
+     * When no token fixes a letter (say ??????? with include "Q"), the rarest
+     * included letter is the pivot instead, tried at each token that can hold it.
+     */
+
+    struct PatternToken {
+        uint32_t letters;   // Allowed letters, bit (letter - 'A')
+        bool repeat;        // '*': zero or more letters
+    };
+
+    struct PatternQuery {
+        std::string pattern;
+        std::string include;   // Letters every match must contain (repeats count: "SS" needs two S)
+        std::string exclude;   // Letters no match may contain
+        int minLength = 2;
+        int maxLength = 15;
+        size_t limit = 0;      // Stop after this many matches (0 = no limit)
+    };
+
+    /**
+     * Parse a pattern into tokens.
+     * @param pattern Pattern text
+     * @param tokens Output tokens
+     * @param error Reason on failure
+     * @return false if the pattern is malformed
+     */
+    bool parsePattern(const std::string& pattern, std::vector<PatternToken>& tokens, std::string& error);
+
+    /**
+     * Stream the words matching a query to a callback, each word once, in no
+     * particular order.
+     * @param gaddag Dictionary
+     * @param query Pattern, letter constraints, lengths and limit
+     * @param onMatch Called with each matching word (upper case)
+     * @param error Reason on failure
+     * @return false if the pattern is malformed
+     */
+    bool searchPattern(const Gaddag& gaddag, const PatternQuery& query,
+                       const std::function<void(const std::string&)>& onMatch, std::string& error);
+
+}
+
+#endif // PATTERN_H
@@ -0,0 +1,205 @@
+#include "Rules.h"
+#include <cctype>
+#include <utility>
+
+namespace Scrabble {
+
+    int letterValue(char letter) {
+        return letterValue<FrenchRules>(letter);
+    }
+
+    int letterCount(char letter) {
+        return letterCount<FrenchRules>(letter);
+    }
+
+    // Value of a tile as it sits on the board (blanks are worth nothing)
+    template <typename Rules>
+    static int tileScore(const Tile& tile) {
+        return tile.isBlank() ? 0 : letterValue<Rules>(tile.letter);
+    }
+
+    int scoreMove(const Board& board, const Move& move) {
+        return scoreMove<FrenchRules>(board, move);
+    }
+
+    template <typename Rules>
+    int scoreMove(const typename Rules::BoardType& board, const Move& move) {
+        int dr = move.horizontal ? 0 : 1;
+        int dc = move.horizontal ? 1 : 0;
+
+        int mainSum = 0;
+        int mainMultiplier = 1;
+        int crossTotal = 0;
+        int placedIndex = 0;
+
+        for (size_t i = 0; i < move.word.length(); ++i) {
+            int r = move.row + dr * (int)i;
+            int c = move.col + dc * (int)i;
+
+            if (!board.isEmpty(r, c)) {
+                // Existing tile: face value only, premiums are already used up
+                mainSum += tileScore<Rules>(board.getTile(r, c));
+                continue;
+            }
+
+            if (placedIndex >= move.tileCount) break;
+            const Tile& placed = move.tiles[placedIndex++];
+
+            int letterScore = tileScore<Rules>(placed);
+            int wordMultiplier = 1;
+            switch (board.getBonus(r, c)) {
+                case Bonus::DoubleLetter: letterScore *= 2; break;
+                case Bonus::TripleLetter: letterScore *= 3; break;
+                case Bonus::QuadrupleLetter: letterScore *= 4; break;
+                case Bonus::DoubleWord: wordMultiplier = 2; break;
+                case Bonus::TripleWord: wordMultiplier = 3; break;
+                case Bonus::QuadrupleWord: wordMultiplier = 4; break;
+                default: break;
+            }
+
+            mainSum += letterScore;
+            mainMultiplier *= wordMultiplier;
+
+            // Cross-word formed perpendicular to the move through (r, c)
+            int crossSum = 0;
+            bool hasCross = false;
+            int pr = r - dc, pc = c - dr;
+            while (!board.getTile(pr, pc).isEmpty()) { // getTile is empty off-board
+                crossSum += tileScore<Rules>(board.getTile(pr, pc));
+                hasCross = true;
+                pr -= dc; pc -= dr;
+            }
+            pr = r + dc; pc = c + dr;
+            while (!board.getTile(pr, pc).isEmpty()) { // getTile is empty off-board
+                crossSum += tileScore<Rules>(board.getTile(pr, pc));
+                hasCross = true;
+                pr += dc; pc += dr;
+            }
+            if (hasCross) {
+                crossTotal += (crossSum + letterScore) * wordMultiplier;
+            }
+        }
+
+        int total = mainSum * mainMultiplier + crossTotal;
+        if (move.tileCount == Rules::RACK_SIZE) total += Rules::BINGO_BONUS;
+        return total;
+    }
+
+    template int scoreMove<FrenchRules>(const FrenchRules::BoardType&, const Move&);
+    template int scoreMove<EnglishRules>(const EnglishRules::BoardType&, const Move&);
+    template int scoreMove<SuperRules>(const SuperRules::BoardType&, const Move&);
+
+    template <int N>
+    void applyMove(BasicBoard<N>& board, const Move& move) {
+        int dr = move.horizontal ? 0 : 1;
+        int dc = move.horizontal ? 1 : 0;
+        int placedIndex = 0;
+
+        for (size_t i = 0; i < move.word.length() && placedIndex < move.tileCount; ++i) {
+            int r = move.row + dr * (int)i;
+            int c = move.col + dc * (int)i;
+            if (board.isEmpty(r, c)) {
+                board.setTile(r, c, move.tiles[placedIndex++]);
+            }
+        }
+    }
+
+    template void applyMove<15>(BasicBoard<15>&, const Move&);
+    template void applyMove<21>(BasicBoard<21>&, const Move&);
+
+    bool resolveTiles(Move& move, const std::vector<char>& rack) {
+        return resolveTiles<FrenchRules>(move, rack);
+    }
+
+    template <typename Rules>
+    bool resolveTiles(Move& move, const std::vector<char>& rack) {
+        int counts[26] = {0};
+        int blanks = 0;
+        for (char c : rack) {
+            if (isBlankTile(c)) blanks++;
+            else if (c >= 'A' && c <= 'Z') counts[c - 'A']++;
+        }
+
+        for (int i = 0; i < move.tileCount; ++i) {
+            char letter = move.tiles[i].letter;
+            if (letter >= 'A' && letter <= 'Z' && counts[letter - 'A'] > 0) {
+                counts[letter - 'A']--;
+                move.tiles[i] = Tile(letter, letterValue<Rules>(letter));
+            } else if (blanks > 0) {
+                blanks--;
+                move.tiles[i] = Tile(letter, 0);
+            } else {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    template bool resolveTiles<FrenchRules>(Move&, const std::vector<char>&);
+    template bool resolveTiles<EnglishRules>(Move&, const std::vector<char>&);
+    template bool resolveTiles<SuperRules>(Move&, const std::vector<char>&);
+
+    bool resolveAndScore(const Board& board, Move& move, const std::vector<char>& rack) {
+        return resolveAndScore<FrenchRules>(board, move, rack);
+    }
+
+    template <typename Rules>
+    bool resolveAndScore(const typename Rules::BoardType& board, Move& move, const std::vector<char>& rack) {
+        if (!resolveTiles<Rules>(move, rack)) return false;
+        int best = scoreMove<Rules>(board, move);
+
+        // What a blank costs depends only on its own square, so each blank can
+        // move independently to the best square still holding a real copy of its letter
+        for (int i = 0; i < move.tileCount; ++i) {
+            if (move.tiles[i].value != 0) continue;
+            int target = -1;
+            for (int j = 0; j < move.tileCount; ++j) {
+                if (move.tiles[j].value == 0 || move.tiles[j].letter != move.tiles[i].letter) continue;
+                std::swap(move.tiles[i], move.tiles[j]);
+                int score = scoreMove<Rules>(board, move);
+                std::swap(move.tiles[i], move.tiles[j]);
+                if (score > best) {
+                    best = score;
+                    target = j;
+                }
+            }
+            if (target >= 0) std::swap(move.tiles[i], move.tiles[target]);
+        }
+        move.score = best;
+        return true;
+    }
+
+    template bool resolveAndScore<FrenchRules>(const FrenchRules::BoardType&, Move&, const std::vector<char>&);
+    template bool resolveAndScore<EnglishRules>(const EnglishRules::BoardType&, Move&, const std::vector<char>&);
+    template bool resolveAndScore<SuperRules>(const SuperRules::BoardType&, Move&, const std::vector<char>&);
+
+    Board boardFromString(const std::string& boardStr) {
+        Board board;
+        for (int r = 0; r < 15; ++r) {
+            for (int c = 0; c < 15; ++c) {
+                size_t idx = (size_t)(r * 15 + c);
+                if (idx >= boardStr.length()) return board;
+                char ch = boardStr[idx];
+                if (ch >= 'A' && ch <= 'Z') {
+                    board.setTile(r, c, Tile(ch, letterValue(ch)));
+                } else if (ch >= 'a' && ch <= 'z') {
+                    board.setTile(r, c, Tile((char)std::toupper(ch), 0)); // Blank
+                }
+            }
+        }
+        return board;
+    }
+
+    std::string boardToString(const Board& board) {
+        std::string out(225, '.');
+        for (int r = 0; r < 15; ++r) {
+            for (int c = 0; c < 15; ++c) {
+                Tile t = board.getTile(r, c);
+                if (t.isEmpty()) continue;
+                out[r * 15 + c] = t.isBlank() ? (char)std::tolower(t.letter) : t.letter;
+            }
+        }
+        return out;
+    }
+
+}
@@ -0,0 +1,134 @@
+#ifndef RULES_H
+#define RULES_H
+
+#include "engine.h"
+#include "Ruleset.h"
+#include <string>
+#include <vector>
+
+namespace Scrabble {
+
+    // Number of tiles a player holds
+    const int RACK_SIZE = FrenchRules::RACK_SIZE;
+
+    // Bonus awarded when all seven rack tiles are placed in one move
+    const int BINGO_BONUS = FrenchRules::BINGO_BONUS;
+
+    // Canonical blank character used in racks and in the tile bag
+    const char BLANK_TILE = '?';
+
+    // Number of consecutive scoreless turns (passes, exchanges) that ends the game
+    const int MAX_SCORELESS_TURNS = 6;
+
+    /**
+     * Point value of a letter in the French distribution.
+     * @param letter Upper case letter, or '?' / '*' for a blank
+     * @return Face value (0 for blanks and unknown characters)
+     */
+    int letterValue(char letter);
+
+    /**
+     * Number of copies of a letter in the French tile set (102 tiles).
+     * @param letter Upper case letter, or '?' for a blank
+     * @return Number of tiles of this kind in a full bag
+     */
+    int letterCount(char letter);
+
+    /**
+     * Check whether a rack character denotes a blank tile.
+     */
+    inline bool isBlankTile(char c) { return c == '?' || c == '*'; }
+
+    /**
+     * Point value of a letter in a ruleset (letterValue(c) is letterValue<FrenchRules>(c)).
+     */
+    template <typename Rules>
+    inline int letterValue(char letter) {
+        return letter >= 'A' && letter <= 'Z' ? Rules::VALUES[letter - 'A'] : 0;
+    }
+
+    /**
+     * Number of copies of a tile in a ruleset's bag.
+     */
+    template <typename Rules>
+    inline int letterCount(char letter) {
+        if (letter >= 'A' && letter <= 'Z') return Rules::COUNTS[letter - 'A'];
+        return isBlankTile(letter) ? Rules::BLANKS : 0;
+    }
+
+    /**
+     * Score a move on the board it is about to be played on.
+     * Counts the main word and every cross-word formed by newly placed tiles,
+     * premium squares under new tiles, and the bingo bonus.
+     * Placed tiles with value 0 are treated as blanks.
+     * @param board Board before the move is applied
+     * @param move The move (tiles[] in the order of the empty squares it covers)
+     * @return Total score of the move
+     */
+    int scoreMove(const Board& board, const Move& move);
+
+    /**
+     * Same, with the tile values, premium squares and bingo bonus of a ruleset.
+     * Instantiated for FrenchRules, EnglishRules and SuperRules.
+     */
+    template <typename Rules>
+    int scoreMove(const typename Rules::BoardType& board, const Move& move);
+
+    /**
+     * Place the tiles of a move on the board.
+     * @param board Board to update (any size)
+     * @param move The move to apply
+     */
+    template <int N>
+    void applyMove(BasicBoard<N>& board, const Move& move);
+
+    /**
+     * Assign rack tiles to the placed tiles of a generated move.
+     * Real tiles are preferred; missing letters are taken from blanks (value 0).
+     * Without a board the squares are unknown: when a letter is placed both from
+     * a real tile and from a blank, the blank takes the last occurrences, which
+     * may not be the cheapest squares. Use resolveAndScore to pick them.
+     * @param move Move whose tiles[] are rewritten with real values
+     * @param rack Rack the move was generated from
+     * @return false if the rack cannot supply the move
+     */
+    bool resolveTiles(Move& move, const std::vector<char>& rack);
+
+    /**
+     * Same, with the tile values of a ruleset.
+     */
+    template <typename Rules>
+    bool resolveTiles(Move& move, const std::vector<char>& rack);
+
+    /**
+     * Assign rack tiles as resolveTiles does, then move each blank to the
+     * occurrence of its letter where it loses the fewest points, and score the move.
+     * @param board Board before the move is applied
+     * @param move Move whose tiles[] and score are rewritten
+     * @param rack Rack the move was generated from
+     * @return false if the rack cannot supply the move
+     */
+    bool resolveAndScore(const Board& board, Move& move, const std::vector<char>& rack);
+
+    /**
+     * Same, with the tile values and premium squares of a ruleset.
+     */
+    template <typename Rules>
+    bool resolveAndScore(const typename Rules::BoardType& board, Move& move, const std::vector<char>& rack);
+
+    /**
+     * Parse the compact 225-character board format used by the benchmark files.
+     * '.' is an empty square, upper case a regular tile, lower case a blank.
+     * @param boardStr Row-major board string
+     * @return The decoded board
+     */
+    Board boardFromString(const std::string& boardStr);
+
+    /**
+     * Serialise a board to the compact 225-character format (see boardFromString).
+     */
+    std::string boardToString(const Board& board);
+
+}
+
+#endif // RULES_H
@@ -0,0 +1,95 @@
+#ifndef RULESET_H
+#define RULESET_H
+
+#include "engine.h"
+
+namespace Scrabble {
+
+    /*
+     * Game variants as compile-time rulesets.
+     *
+     * A ruleset names its board type (which fixes the geometry and the premium
+     * layout, see BoardLayout), the tile values and distribution, the rack size and
+     * the bingo bonus. Code that depends on the variant takes the ruleset as a
+     * template parameter, so every table and bound is a constant of the
+     * instantiation; the untemplated API (Rules.h, Board, MoveGenerator) is the
+     * French 15x15 game.
+     *
+     * Members of a ruleset:
+     *   NAME           Variant name
+     *   BoardType      BasicBoard<N> of the variant
+     *   RACK_SIZE      Tiles on a rack
+     *   BINGO_BONUS    Bonus for playing RACK_SIZE tiles at once
+     *   BLANKS         Blank tiles in the bag
+     *   VALUES[26]     Tile values, by letter - 'A'
+     *   COUNTS[26]     Tiles of each letter in the bag, by letter - 'A'
+     */
+
+    // French Scrabble: 15x15, 102 tiles
+    struct FrenchRules {
+        static constexpr const char* NAME = "french";
+        using BoardType = BasicBoard<15>;
+        static constexpr int RACK_SIZE = 7;
+        static constexpr int BINGO_BONUS = 50;
+        static constexpr int BLANKS = 2;
+        static constexpr int VALUES[26] = {
+            1, 3, 3, 2, 1, 4, 2, 4, 1, 8, 10, 1, 2,     // A - M
+            1, 1, 3, 8, 1, 1, 1, 1, 4, 10, 10, 10, 10   // N - Z
+        };
+        static constexpr int COUNTS[26] = {
+            9, 2, 2, 3, 15, 2, 2, 2, 8, 1, 1, 5, 3,     // A - M
+            6, 6, 2, 1, 6, 6, 6, 6, 2, 1, 1, 1, 1       // N - Z
+        };
+    };
+
+    // English Scrabble: 15x15, 100 tiles
+    struct EnglishRules {
+        static constexpr const char* NAME = "english";
+        using BoardType = BasicBoard<15>;
+        static constexpr int RACK_SIZE = 7;
+        static constexpr int BINGO_BONUS = 50;
+        static constexpr int BLANKS = 2;
+        static constexpr int VALUES[26] = {
+            1, 3, 3, 2, 1, 4, 2, 4, 1, 8, 5, 1, 3,      // A - M
+            1, 1, 3, 10, 1, 1, 1, 1, 4, 4, 8, 4, 10     // N - Z
+        };
+        static constexpr int COUNTS[26] = {
+            9, 2, 2, 4, 12, 2, 3, 2, 9, 1, 1, 4, 2,     // A - M
+            6, 8, 2, 1, 6, 4, 6, 4, 2, 2, 1, 2, 1       // N - Z
+        };
+    };
+
+    // Super Scrabble (English): 21x21 board with quadruple squares, 200 tiles
+    struct SuperRules {
+        static constexpr const char* NAME = "super";
+        using BoardType = BasicBoard<21>;
+        static constexpr int RACK_SIZE = 7;
+        static constexpr int BINGO_BONUS = 50;
+        static constexpr int BLANKS = 4;
+        static constexpr int VALUES[26] = {
+            1, 3, 3, 2, 1, 4, 2, 4, 1, 8, 5, 1, 3,      // A - M
+            1, 1, 3, 10, 1, 1, 1, 1, 4, 4, 8, 4, 10     // N - Z
+        };
+        static constexpr int COUNTS[26] = {
+            16, 4, 6, 8, 24, 4, 5, 5, 13, 2, 2, 7, 6,   // A - M
+            13, 15, 4, 2, 13, 10, 15, 7, 3, 4, 2, 4, 2  // N - Z
+        };
+    };
+
+    /**
+     * Number of tiles in a full bag of a ruleset.
+     */
+    template <typename Rules>
+    constexpr int bagSize() {
+        int total = Rules::BLANKS;
+        for (int count : Rules::COUNTS) total += count;
+        return total;
+    }
+
+    static_assert(bagSize<FrenchRules>() == 102, "French tile set has 102 tiles");
+    static_assert(bagSize<EnglishRules>() == 100, "English tile set has 100 tiles");
+    static_assert(bagSize<SuperRules>() == 200, "Super tile set has 200 tiles");
+
+}
+
+#endif // RULESET_H
@@ -0,0 +1,127 @@
+#include "SelfPlay.h"
+#include "Rules.h"
+#include "Openings.h"
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <thread>
+
+namespace Scrabble {
+
+    int GreedyPolicy::selectMove(const Game&, const std::vector<Move>& moves) {
+        int best = -1;
+        for (size_t i = 0; i < moves.size(); ++i) {
+            if (best < 0 || moves[i].score > moves[best].score) best = (int)i;
+        }
+        return best;
+    }
+
+    int RandomPolicy::selectMove(const Game&, const std::vector<Move>& moves) {
+        if (moves.empty()) return -1;
+        std::uniform_int_distribution<size_t> dist(0, moves.size() - 1);
+        return (int)dist(rng);
+    }
+
+    PolicyFactory policyByName(const std::string& name) {
+        if (name == "greedy") {
+            return [](uint64_t) { return std::unique_ptr<MovePolicy>(new GreedyPolicy()); };
+        }
+        if (name == "random") {
+            return [](uint64_t seed) { return std::unique_ptr<MovePolicy>(new RandomPolicy(seed)); };
+        }
+        return PolicyFactory();
+    }
+
+    uint64_t gameSeed(uint64_t seed, uint64_t index) {
+        uint64_t z = seed + 0x9E3779B97F4A7C15ULL * (index + 1);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+        return z ^ (z >> 31);
+    }
+
+    void playGame(Game& game, MovePolicy* policies[Game::NUM_PLAYERS],
+                  const MoveGenerator& generator, const Gaddag& gaddag, SelfPlayStats& stats,
+                  GameObserver* observer, const OpeningTable* openings, MoveCache* cache) {
+        std::vector<Move> moves;
+        while (!game.isOver()) {
+            // First move: served from the table when the rack is in it
+            bool fromTable = openings && isBoardEmpty(game.getBoard()) &&
+                             openings->lookup(game.getRack(game.currentPlayer()), moves);
+            if (!fromTable) moves = cache ? game.legalMoves(generator, gaddag, *cache) : game.legalMoves(generator, gaddag);
+            stats.candidates += (long long)moves.size();
+
+            int choice = policies[game.currentPlayer()]->selectMove(game, moves);
+            if (choice < 0 || choice >= (int)moves.size()) choice = -1;
+            if (observer) observer->onTurn(game, moves, choice);
+
+            if (choice >= 0 && game.play(moves[choice])) {
+                stats.plays++;
+            } else if (!game.exchange(game.getRack(game.currentPlayer()))) {
+                game.pass();
+            }
+            stats.turns++;
+        }
+        if (observer) observer->onGameEnd(game);
+
+        stats.games++;
+        for (int p = 0; p < Game::NUM_PLAYERS; ++p) {
+            stats.totalScore += game.getScore(p);
+        }
+    }
+
+    SelfPlayStats runSelfPlay(const Gaddag& gaddag, const SelfPlayConfig& config) {
+        SelfPlayStats total;
+        std::atomic<int> nextGame(0);
+        std::mutex statsMutex;
+        int threadCount = config.threads > 0 ? config.threads : 1;
+
+        auto worker = [&]() {
+            MoveGenerator generator;
+            MoveCache cache;
+            PolicyFactory factories[Game::NUM_PLAYERS];
+            for (int p = 0; p < Game::NUM_PLAYERS; ++p) {
+                factories[p] = config.policies[p] ? config.policies[p] : policyByName("greedy");
+            }
+            std::unique_ptr<GameObserver> observer;
+            if (config.observer) observer = config.observer();
+
+            // Accumulate locally, merge once at the end
+            SelfPlayStats local;
+            int index;
+            while ((index = nextGame.fetch_add(1)) < config.games) {
+                uint64_t seed = gameSeed(config.seed, (uint64_t)index);
+                Game game(seed);
+
+                // Policies are seeded from the game, not the thread, so a game replays the same
+                // way whatever the thread count and the order in which games are handed out
+                std::unique_ptr<MovePolicy> owned[Game::NUM_PLAYERS];
+                MovePolicy* policies[Game::NUM_PLAYERS];
+                for (int p = 0; p < Game::NUM_PLAYERS; ++p) {
+                    owned[p] = factories[p](gameSeed(seed ^ 0xA5A5A5A5ULL, (uint64_t)p));
+                    policies[p] = owned[p].get();
+                }
+                if (observer) observer->onGameStart(game, (uint64_t)index);
+                playGame(game, policies, generator, gaddag, local, observer.get(), config.openings, &cache);
+            }
+
+            std::lock_guard<std::mutex> lock(statsMutex);
+            total.games += local.games;
+            total.turns += local.turns;
+            total.plays += local.plays;
+            total.candidates += local.candidates;
+            total.totalScore += local.totalScore;
+        };
+
+        auto tStart = std::chrono::steady_clock::now();
+        std::vector<std::thread> workers;
+        for (int t = 0; t < threadCount; ++t) {
+            workers.emplace_back(worker);
+        }
+        for (std::thread& th : workers) th.join();
+        auto tEnd = std::chrono::steady_clock::now();
+
+        total.seconds = std::chrono::duration<double>(tEnd - tStart).count();
+        return total;
+    }
+
+}
@@ -0,0 +1,142 @@
+#ifndef SELF_PLAY_H
+#define SELF_PLAY_H
+
+#include "Game.h"
+#include <vector>
+#include <string>
+#include <memory>
+#include <functional>
+#include <random>
+#include <cstdint>
+
+namespace Scrabble {
+
+    class OpeningTable;
+
+    /**
+     * Move-selection strategy used by self-play.
+     * A policy instance is only ever used by one thread.
+     */
+    class MovePolicy {
+    public:
+        virtual ~MovePolicy() {}
+
+        /**
+         * Choose a move for the player to move.
+         * @param game Current game state
+         * @param moves Scored legal moves (see Game::legalMoves)
+         * @return Index into moves, or -1 to exchange/pass instead
+         */
+        virtual int selectMove(const Game& game, const std::vector<Move>& moves) = 0;
+    };
+
+    /**
+     * Always plays the highest-scoring move.
+     */
+    class GreedyPolicy : public MovePolicy {
+    public:
+        int selectMove(const Game& game, const std::vector<Move>& moves) override;
+    };
+
+    /**
+     * Plays a uniformly random legal move.
+     */
+    class RandomPolicy : public MovePolicy {
+    private:
+        std::mt19937_64 rng;
+
+    public:
+        explicit RandomPolicy(uint64_t seed) : rng(seed) {}
+        int selectMove(const Game& game, const std::vector<Move>& moves) override;
+    };
+
+    // Creates a fresh policy for one game, from a seed derived from the game's (seed, index)
+    using PolicyFactory = std::function<std::unique_ptr<MovePolicy>(uint64_t seed)>;
+
+    /**
+     * Receives every decision taken during self-play (e.g. to export training data).
+     * An observer instance is only ever used by one thread.
+     */
+    class GameObserver {
+    public:
+        virtual ~GameObserver() {}
+
+        // Called before the first turn of a game
+        virtual void onGameStart(const Game& game, uint64_t gameIndex) { (void)game; (void)gameIndex; }
+
+        // Called before the chosen move is applied. chosen is -1 for an exchange/pass.
+        virtual void onTurn(const Game& game, const std::vector<Move>& moves, int chosen) { (void)game; (void)moves; (void)chosen; }
+
+        // Called once the game is over and final scores are known
+        virtual void onGameEnd(const Game& game) { (void)game; }
+    };
+
+    // Creates a fresh observer for one worker thread
+    using ObserverFactory = std::function<std::unique_ptr<GameObserver>()>;
+
+    /**
+     * Build a policy factory from its name ("greedy" or "random").
+     * @return Empty factory if the name is unknown
+     */
+    PolicyFactory policyByName(const std::string& name);
+
+    struct SelfPlayConfig {
+        int games;          // Number of games to play
+        int threads;        // Worker threads (games are independent)
+        uint64_t seed;      // Base seed; game i uses a seed derived from (seed, i)
+        PolicyFactory policies[Game::NUM_PLAYERS];
+        ObserverFactory observer;   // Optional
+        const OpeningTable* openings;   // Optional: first moves come from the table (best moves only)
+
+        SelfPlayConfig() : games(1), threads(1), seed(1), openings(nullptr) {}
+    };
+
+    struct SelfPlayStats {
+        long long games;       // Completed games
+        long long turns;       // Turns taken (plays, exchanges and passes)
+        long long plays;       // Tile placements
+        long long candidates;  // Legal moves generated over all turns
+        long long totalScore;  // Sum of final scores of all players
+        double seconds;        // Wall-clock time
+
+        SelfPlayStats() : games(0), turns(0), plays(0), candidates(0), totalScore(0), seconds(0) {}
+
+        double gamesPerSecond() const { return seconds > 0 ? games / seconds : 0; }
+        double movesPerSecond() const { return seconds > 0 ? turns / seconds : 0; }
+    };
+
+    /**
+     * Seed of game `index` in a run with base seed `seed` (splitmix64 mixing).
+     */
+    uint64_t gameSeed(uint64_t seed, uint64_t index);
+
+    /**
+     * Play one game to completion.
+     * When the policy declines to place (or no move exists), the player exchanges
+     * the whole rack if the bag allows it, and passes otherwise.
+     * @param game Freshly created game
+     * @param policies One policy per player
+     * @param generator Move generator
+     * @param gaddag Dictionary
+     * @param stats Counters to accumulate into
+     * @param observer Optional observer notified of every turn
+     * @param openings Optional opening table; on an empty board, policies then
+     *                 choose among the table's best moves instead of every move
+     * @param cache Optional line cache reused across turns (same moves, less work)
+     */
+    void playGame(Game& game, MovePolicy* policies[Game::NUM_PLAYERS],
+                  const MoveGenerator& generator, const Gaddag& gaddag, SelfPlayStats& stats,
+                  GameObserver* observer = nullptr, const OpeningTable* openings = nullptr,
+                  MoveCache* cache = nullptr);
+
+    /**
+     * Play `config.games` independent games over `config.threads` threads.
+     * @param gaddag Shared, read-only dictionary
+     * @param config Run configuration
+     * @return Aggregated counters and wall-clock time
+     */
+    SelfPlayStats runSelfPlay(const Gaddag& gaddag, const SelfPlayConfig& config);
+
+}
+
+#endif // SELF_PLAY_H
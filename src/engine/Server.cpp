@@ -0,0 +1,404 @@
+#include "Server.h"
+#include "Game.h"
+#include "Rules.h"
+#include "Validation.h"
+#include <algorithm>
+#include <sstream>
+#include <cctype>
+#include <cerrno>
+#include <cstring>
+#include <iostream>
+#include <list>
+#include <atomic>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+
+namespace Scrabble {
+
+    static std::string trim(const std::string& s) {
+        size_t first = s.find_first_not_of(" \t\r\n");
+        if (first == std::string::npos) return "";
+        size_t last = s.find_last_not_of(" \t\r\n");
+        return s.substr(first, last - first + 1);
+    }
+
+    static bool isBoardString(const std::string& s) {
+        if (s.length() != 225) return false;
+        for (char c : s) {
+            if (c != '.' && !std::isalpha((unsigned char)c)) return false;
+        }
+        return true;
+    }
+
+    bool parseRequest(const std::string& line, SolverRequest& request, std::string& error) {
+        std::vector<std::string> fields;
+        std::stringstream ss(line);
+        std::string field;
+        while (std::getline(ss, field, '|')) fields.push_back(trim(field));
+
+        if (fields.size() < 2 || fields.size() > 3) {
+            error = "expected <board> | <rack> [| <mode>]";
+            return false;
+        }
+
+        request = SolverRequest();
+        request.board = fields[0];
+        if (!isBoardString(request.board)) {
+            error = "board must be 225 characters of letters and '.'";
+            return false;
+        }
+
+        for (char c : fields[1]) {
+            if (std::isalpha((unsigned char)c)) request.rack.push_back((char)std::toupper((unsigned char)c));
+            else if (isBlankTile(c)) request.rack.push_back(c);
+            else {
+                error = "invalid rack";
+                return false;
+            }
+        }
+        if (request.rack.empty() || request.rack.length() > (size_t)RACK_SIZE) {
+            error = "rack must hold 1 to 7 tiles";
+            return false;
+        }
+
+        if (fields.size() == 2) return true;
+
+        std::stringstream mode(fields[2]);
+        std::string name;
+        mode >> name;
+        if (name == "all") {
+            request.mode = RequestMode::All;
+        } else if (name == "top") {
+            long k = 0;
+            if (!(mode >> k) || k <= 0) {
+                error = "top needs a positive count";
+                return false;
+            }
+            request.mode = RequestMode::TopK;
+            request.k = (size_t)k;
+        } else if (name == "validate") {
+            mode >> request.placement;
+            if (!isBoardString(request.placement)) {
+                error = "validate needs a 225-character placement";
+                return false;
+            }
+            request.mode = RequestMode::Validate;
+        } else {
+            error = "unknown mode: " + name;
+            return false;
+        }
+
+        std::string extra;
+        if (request.mode != RequestMode::Validate && mode >> extra) {
+            if (extra != "within") {
+                error = "unexpected text after mode";
+                return false;
+            }
+            if (!(mode >> request.withinMs) || request.withinMs <= 0) {
+                error = "within needs a positive number of milliseconds";
+                return false;
+            }
+        }
+        if (mode >> extra) {
+            error = "unexpected text after mode";
+            return false;
+        }
+        return true;
+    }
+
+    std::string placementString(const Board& board, const Move& move) {
+        std::string out(225, '.');
+        int placed = 0;
+        for (size_t i = 0; i < move.word.length() && placed < move.tileCount; ++i) {
+            int r = move.row + (move.horizontal ? 0 : (int)i);
+            int c = move.col + (move.horizontal ? (int)i : 0);
+            if (!board.isEmpty(r, c)) continue;
+            const Tile& t = move.tiles[placed++];
+            out[r * 15 + c] = t.isBlank() ? (char)std::tolower(move.word[i]) : move.word[i];
+        }
+        return out;
+    }
+
+    static void appendMove(std::string& out, const Board& board, const Move& m) {
+        out += placementString(board, m);
+        out += " | ";
+        out += std::to_string(m.score);
+        out += " | ";
+        out += std::to_string(m.row);
+        out += ' ';
+        out += std::to_string(m.col);
+        out += m.horizontal ? " H " : " V ";
+        out += m.word;
+        out += '\n';
+    }
+
+    SolverServer::SolverServer(const Gaddag& gaddag, int threads, size_t inFlightLimit)
+        : gaddag(gaddag), lazy(nullptr), stopping(false), listenFd(-1),
+          maxInFlight(std::max<size_t>(1, inFlightLimit)) {
+        if (threads < 1) threads = 1;
+        for (int i = 0; i < threads; ++i) {
+            workers.emplace_back(&SolverServer::workerLoop, this);
+        }
+    }
+
+    SolverServer::SolverServer(const LazyGaddag& lexicon, int threads, size_t inFlightLimit)
+        : gaddag(lexicon.gaddag()), lazy(&lexicon), stopping(false), listenFd(-1),
+          maxInFlight(std::max<size_t>(1, inFlightLimit)) {
+        if (threads < 1) threads = 1;
+        for (int i = 0; i < threads; ++i) {
+            workers.emplace_back(&SolverServer::workerLoop, this);
+        }
+    }
+
+    SolverServer::~SolverServer() {
+        {
+            std::lock_guard<std::mutex> lock(jobsMutex);
+            stopping = true;
+        }
+        jobsReady.notify_all();
+        for (std::thread& t : workers) t.join();
+    }
+
+    std::string SolverServer::handle(const std::string& line, const MoveGenerator& generator) const {
+        GenContext context;
+        return handle(line, generator, context);
+    }
+
+    std::string SolverServer::handle(const std::string& line, const MoveGenerator& generator,
+                                     GenContext& context) const {
+        SolverRequest request;
+        std::string error;
+        if (!parseRequest(line, request, error)) return "ERR " + error + "\n";
+
+        Board board = boardFromString(request.board);
+        std::vector<char> rack(request.rack.begin(), request.rack.end());
+        std::string out;
+        // Validation and deadline search read the complete graph: wait for it
+        bool cold = lazy && !lazy->isWarm();
+        if (cold && (request.mode == RequestMode::Validate || request.withinMs > 0)) {
+            lazy->warmUp();
+            cold = false;
+        }
+        if (request.mode == RequestMode::Validate) {
+            // Checks the placement alone, without generating the move list
+            MoveValidation validation = validateMove(board, request.placement, gaddag, rack);
+            if (!validation.ok()) return std::string("ERR illegal move: ") + moveErrorName(validation.error) + "\n";
+            out = "OK 1\n";
+            appendMove(out, board, validation.move);
+            return out;
+        }
+
+        std::vector<Move> moves;
+        bool complete = true;
+        if (request.withinMs > 0) {
+            SearchBudget budget = SearchBudget::within(
+                std::chrono::microseconds((long long)(request.withinMs * 1000.0)));
+            MoveSearchResult result = searchScoredMoves(board, rack, generator, gaddag, budget);
+            moves = std::move(result.moves);
+            complete = result.complete;
+        } else {
+            moves = cold ? generateScoredMoves(board, rack, generator, *lazy, context)
+                         : generateScoredMoves(board, rack, generator, gaddag, context);
+        }
+
+        std::sort(moves.begin(), moves.end(), [](const Move& a, const Move& b) {
+            if (a.score != b.score) return a.score > b.score;
+            if (a.row != b.row) return a.row < b.row;
+            if (a.col != b.col) return a.col < b.col;
+            if (a.horizontal != b.horizontal) return a.horizontal > b.horizontal;
+            return a.word < b.word;
+        });
+
+        if (request.mode == RequestMode::TopK && moves.size() > request.k) moves.resize(request.k);
+        out = "OK " + std::to_string(moves.size()) + (complete ? "\n" : " partial\n");
+        out.reserve(out.size() + moves.size() * 256);
+        for (const Move& m : moves) appendMove(out, board, m);
+        return out;
+    }
+
+    void SolverServer::workerLoop() {
+        MoveGenerator generator;
+        GenContext context;
+        while (true) {
+            Job job;
+            {
+                std::unique_lock<std::mutex> lock(jobsMutex);
+                jobsReady.wait(lock, [this] { return stopping || !jobs.empty(); });
+                if (jobs.empty()) return;
+                job = std::move(jobs.front());
+                jobs.pop_front();
+            }
+            try {
+                job.result.set_value(handle(job.line, generator, context));
+            } catch (...) {
+                job.result.set_value("ERR internal error\n");
+            }
+        }
+    }
+
+    std::future<std::string> SolverServer::submit(const std::string& line) {
+        Job job;
+        job.line = line;
+        std::future<std::string> result = job.result.get_future();
+        {
+            std::lock_guard<std::mutex> lock(jobsMutex);
+            jobs.push_back(std::move(job));
+        }
+        jobsReady.notify_one();
+        return result;
+    }
+
+    static bool writeAll(int fd, const std::string& data) {
+        size_t done = 0;
+        while (done < data.size()) {
+            ssize_t n = ::write(fd, data.data() + done, data.size() - done);
+            if (n < 0) {
+                if (errno == EINTR) continue;
+                return false;
+            }
+            done += (size_t)n;
+        }
+        return true;
+    }
+
+    void SolverServer::serve(int inFd, int outFd) {
+        // Responses are queued in request order; the writer waits on each in turn
+        std::deque<std::future<std::string>> pending;
+        std::mutex pendingMutex;
+        std::condition_variable pendingChanged;
+        bool inputDone = false;
+        bool broken = false;
+
+        std::thread writer([&]() {
+            while (true) {
+                std::future<std::string> next;
+                {
+                    std::unique_lock<std::mutex> lock(pendingMutex);
+                    pendingChanged.wait(lock, [&] { return inputDone || !pending.empty(); });
+                    if (pending.empty()) return;
+                    next = std::move(pending.front());
+                    pending.pop_front();
+                }
+                pendingChanged.notify_all();
+                std::string response = next.get();
+                if (!broken && !writeAll(outFd, response)) {
+                    std::lock_guard<std::mutex> lock(pendingMutex);
+                    broken = true;
+                }
+            }
+        });
+
+        std::string buffer;
+        char chunk[65536];
+        bool quit = false;
+        while (!quit) {
+            ssize_t n = ::read(inFd, chunk, sizeof(chunk));
+            if (n < 0 && errno == EINTR) continue;
+            if (n <= 0) break;
+            buffer.append(chunk, (size_t)n);
+
+            size_t start = 0;
+            size_t end;
+            while ((end = buffer.find('\n', start)) != std::string::npos) {
+                std::string line = trim(buffer.substr(start, end - start));
+                start = end + 1;
+                if (line.empty()) continue;
+                if (line == "quit") {
+                    quit = true;
+                    break;
+                }
+
+                std::unique_lock<std::mutex> lock(pendingMutex);
+                pendingChanged.wait(lock, [&] { return broken || pending.size() < maxInFlight; });
+                if (broken) {
+                    quit = true;
+                    break;
+                }
+                pending.push_back(submit(line));
+                lock.unlock();
+                pendingChanged.notify_all();
+            }
+            buffer.erase(0, start);
+        }
+
+        // A last request without a trailing newline is still answered
+        std::string tail = trim(buffer);
+        if (!quit && !tail.empty() && tail != "quit") {
+            std::lock_guard<std::mutex> lock(pendingMutex);
+            pending.push_back(submit(tail));
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(pendingMutex);
+            inputDone = true;
+        }
+        pendingChanged.notify_all();
+        writer.join();
+    }
+
+    bool SolverServer::listenUnix(const std::string& path) {
+        sockaddr_un addr;
+        std::memset(&addr, 0, sizeof(addr));
+        addr.sun_family = AF_UNIX;
+        if (path.length() >= sizeof(addr.sun_path)) {
+            std::cerr << "Socket path too long: " << path << std::endl;
+            return false;
+        }
+        std::strncpy(addr.sun_path, path.c_str(), sizeof(addr.sun_path) - 1);
+
+        int fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+        if (fd < 0) {
+            std::cerr << "Error creating socket: " << std::strerror(errno) << std::endl;
+            return false;
+        }
+        ::unlink(path.c_str());
+        if (::bind(fd, (sockaddr*)&addr, sizeof(addr)) < 0 || ::listen(fd, 64) < 0) {
+            std::cerr << "Error listening on " << path << ": " << std::strerror(errno) << std::endl;
+            ::close(fd);
+            return false;
+        }
+        listenFd = fd;
+
+        // A connection's thread sets done when it returns; the accept loop joins finished
+        // threads before taking the next client, so only live connections are kept
+        struct Connection {
+            std::thread thread;
+            std::atomic<bool> done{false};
+        };
+        std::list<Connection> connections;
+        while (listenFd >= 0) {
+            int client = ::accept(fd, nullptr, nullptr);
+            if (client < 0) {
+                if (errno == EINTR) continue;
+                break;
+            }
+            for (auto it = connections.begin(); it != connections.end();) {
+                if (!it->done.load(std::memory_order_acquire)) {
+                    ++it;
+                    continue;
+                }
+                it->thread.join();
+                it = connections.erase(it);
+            }
+            connections.emplace_back();
+            Connection& connection = connections.back();
+            connection.thread = std::thread([this, client, &connection]() {
+                serve(client, client);
+                ::close(client);
+                connection.done.store(true, std::memory_order_release);
+            });
+        }
+
+        for (Connection& connection : connections) connection.thread.join();
+        ::close(fd);
+        ::unlink(path.c_str());
+        return true;
+    }
+
+    void SolverServer::stopListening() {
+        int fd = listenFd.exchange(-1);
+        if (fd >= 0) ::shutdown(fd, SHUT_RDWR);
+    }
+
+}
@@ -0,0 +1,172 @@
+#ifndef SERVER_H
+#define SERVER_H
+
+#include "engine.h"
+#include "Gaddag.h"
+#include "LazyGaddag.h"
+#include "MoveGenerator.h"
+#include <vector>
+#include <string>
+#include <deque>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <atomic>
+#include <condition_variable>
+
+namespace Scrabble {
+
+    /*
+     * Solver line protocol (one request per line, one response per request):
+     *
+     *   <board> | <rack>                     all legal moves
+     *   <board> | <rack> | all               same
+     *   <board> | <rack> | top <K>           the K best moves by score
+     *   <board> | <rack> | validate <move>   check one placement
+     *
+     * `all` and `top <K>` accept a latency bound, `within <ms>` (fractions allowed):
+     * the search stops at the deadline and returns the best moves found so far
+     * (see searchScoredMoves in Game.h).
+     *
+     * <board> and <rack> use the synthetic_positions.txt format: 225 characters,
+     * row-major, '.' for empty squares, lower case for blanks on the board;
+     * '?' or '*' for blanks in the rack.
+     *
+     * A move is written as a placement string in the same 225-character format,
+     * holding only the tiles it places (lower case when a blank is used).
+     *
+     * Responses:
+     *
+     *   OK <n>                                  followed by n move lines
+     *   OK <n> partial                          same, when a deadline cut the search short
+     *   <placement> | <score> | <row> <col> <H|V> <word>
+     *   ERR <message>                           single line
+     *
+     * Moves are sorted by decreasing score. `validate` answers OK 1 with the
+     * scored move, or "ERR illegal move: <reason>" with a moveErrorName()
+     * reason (Validation.h) if the placement is not legal for the rack.
+     * Requests may be pipelined: responses come back in request order.
+     */
+
+    enum class RequestMode {
+        All,
+        TopK,
+        Validate
+    };
+
+    struct SolverRequest {
+        std::string board;
+        std::string rack;
+        RequestMode mode = RequestMode::All;
+        size_t k = 0;
+        std::string placement;  // Validate only
+        double withinMs = 0;    // Deadline for All/TopK (0 = none)
+    };
+
+    /**
+     * Parse one request line.
+     * @param line The request (without trailing newline)
+     * @param request Filled on success
+     * @param error Reason on failure
+     * @return false if the line is malformed
+     */
+    bool parseRequest(const std::string& line, SolverRequest& request, std::string& error);
+
+    /**
+     * Write a move as a 225-character string holding only the tiles it places.
+     * @param board Board before the move
+     * @param move Move with resolved tiles
+     */
+    std::string placementString(const Board& board, const Move& move);
+
+    /**
+     * Resident solver: holds a loaded dictionary and answers protocol requests
+     * on a pool of worker threads (one GenContext each, the dictionary is shared).
+     */
+    class SolverServer {
+    private:
+        struct Job {
+            std::string line;
+            std::promise<std::string> result;
+        };
+
+        const Gaddag& gaddag;
+        const LazyGaddag* lazy;     // Set when serving a dictionary that may still be loading
+        std::vector<std::thread> workers;
+        std::deque<Job> jobs;
+        std::mutex jobsMutex;
+        std::condition_variable jobsReady;
+        bool stopping;
+
+        std::atomic<int> listenFd;
+        size_t maxInFlight;
+
+        void workerLoop();
+
+    public:
+        /**
+         * Start the worker pool.
+         * @param gaddag Loaded dictionary (must outlive the server)
+         * @param threads Worker threads (at least 1)
+         * @param inFlightLimit Maximum pipelined requests per connection awaiting their response
+         */
+        SolverServer(const Gaddag& gaddag, int threads, size_t inFlightLimit = 1024);
+
+        /**
+         * Start the worker pool on a paged dictionary, before it is fully loaded.
+         * Until it is warm, move lists are generated from the pages they need;
+         * `validate` and `within` requests wait for the whole dictionary.
+         * @param lexicon Opened paged dictionary (must outlive the server)
+         */
+        SolverServer(const LazyGaddag& lexicon, int threads, size_t inFlightLimit = 1024);
+        ~SolverServer();
+
+        SolverServer(const SolverServer&) = delete;
+        SolverServer& operator=(const SolverServer&) = delete;
+
+        /**
+         * Answer one request synchronously on the calling thread.
+         * @param line Request line
+         * @param generator Generator owned by the caller
+         * @return Full response, newline terminated
+         */
+        std::string handle(const std::string& line, const MoveGenerator& generator) const;
+
+        /**
+         * Same, with the caller's generation scratch (one context per thread).
+         */
+        std::string handle(const std::string& line, const MoveGenerator& generator, GenContext& context) const;
+
+        /**
+         * Queue a request on the worker pool.
+         * @return Future holding the response
+         */
+        std::future<std::string> submit(const std::string& line);
+
+        /**
+         * Serve one connection until end of input or a "quit" line.
+         * Requests are dispatched as soon as they are read; responses are
+         * written in request order.
+         * @param inFd Descriptor to read requests from
+         * @param outFd Descriptor to write responses to
+         */
+        void serve(int inFd, int outFd);
+
+        /**
+         * Accept connections on a Unix domain socket, one thread per connection
+         * (threads of closed connections are joined as new ones arrive).
+         * Blocks until stopListening() is called.
+         * @param path Socket path (replaced if it exists)
+         * @return false if the socket cannot be created
+         */
+        bool listenUnix(const std::string& path);
+
+        /**
+         * Make listenUnix() return once open connections are finished.
+         */
+        void stopListening();
+    };
+
+}
+
+#endif // SERVER_H
@@ -0,0 +1,196 @@
+#include "SuccinctGaddag.h"
+#include <fstream>
+#include <iostream>
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+
+namespace Scrabble {
+
+    struct SuccinctHeader {
+        char magic[8];          // "SCRBSG01"
+        uint32_t nodes;
+        uint32_t words;
+        uint64_t bits;          // Length of the LOUDS sequence
+        uint32_t loudsWords;
+        uint32_t rankCount;
+        uint32_t selectCount;
+        uint32_t labelWords;
+        uint32_t terminalWords;
+        uint32_t reserved;
+    };
+
+    static const char SUCCINCT_MAGIC[8] = {'S', 'C', 'R', 'B', 'S', 'G', '0', '1'};
+
+    SuccinctGaddag::SuccinctGaddag() : nodes(0), words(0) {
+        // An empty dictionary: a root without children
+        louds.assign(2, 0);
+        terminals.assign(1, 0);
+        labels.assign(1, 0);
+        buildIndex(1);
+        nodes = 1;
+    }
+
+    SuccinctGaddag::SuccinctGaddag(const Gaddag& gaddag) : nodes(0), words(0) {
+        // Breadth-first walk with children in label order; ids are assigned in visiting order
+        std::vector<const Node*> queue;
+        queue.push_back(gaddag.getRoot());
+        uint64_t bits = 0;
+        std::vector<std::pair<uint32_t, const Node*>> children;
+        for (size_t head = 0; head < queue.size(); ++head) {
+            const Node* node = queue[head];
+            if (louds.size() * 64 < bits + 64) louds.resize(louds.size() * 2 + 1, 0);
+            if (terminals.size() * 64 <= head) terminals.resize(terminals.size() * 2 + 1, 0);
+            if (node->isTerminal) terminals[head / 64] |= 1ull << (head % 64);
+
+            children.clear();
+            for (const auto& edge : node->children) {
+                uint32_t c = code(edge.first);
+                if (c >= 32) continue;  // Not in the alphabet: cannot be encoded
+                children.emplace_back(c, edge.second);
+            }
+            std::sort(children.begin(), children.end(),
+                      [](const std::pair<uint32_t, const Node*>& a, const std::pair<uint32_t, const Node*>& b) {
+                          return a.first < b.first;
+                      });
+            for (const auto& edge : children) {
+                size_t index = queue.size() - 1;    // Edge index = child id - 1
+                if (labels.size() * LABELS_PER_WORD <= index) labels.resize(labels.size() * 2 + 1, 0);
+                labels[index / LABELS_PER_WORD] |= (uint64_t)edge.first << (index % LABELS_PER_WORD * 5);
+                if (edge.first == DELIMITER_CODE && edge.second->isTerminal) words++;  // The path rev(word)+
+                louds[bits / 64] |= 1ull << (bits % 64);
+                bits++;
+                queue.push_back(edge.second);
+            }
+            bits++;  // The 0 closing the node's block
+        }
+        nodes = (uint32_t)queue.size();
+
+        louds.resize(bits / 64 + 1);   // One spare word, so reads past the last block stay in bounds
+        labels.resize(nodes / LABELS_PER_WORD + 1);
+        terminals.resize(nodes / 64 + 1);
+        louds.shrink_to_fit();
+        labels.shrink_to_fit();
+        terminals.shrink_to_fit();
+        buildIndex(bits);
+    }
+
+    void SuccinctGaddag::buildIndex(uint64_t bits) {
+        rankSamples.assign(bits / BLOCK_BITS + 1, 0);
+        selectSamples.clear();
+        uint32_t ones = 0, zeros = 0;
+        for (uint64_t i = 0; i < bits; ++i) {
+            if (i % BLOCK_BITS == 0) rankSamples[i / BLOCK_BITS] = ones;
+            if ((louds[i / 64] >> (i % 64)) & 1u) {
+                ones++;
+            } else {
+                if (zeros % SELECT_STEP == 0) selectSamples.push_back((uint32_t)i);
+                zeros++;
+            }
+        }
+        if (bits % BLOCK_BITS == 0) rankSamples[bits / BLOCK_BITS] = ones;
+        rankSamples.shrink_to_fit();
+        selectSamples.shrink_to_fit();
+    }
+
+    size_t SuccinctGaddag::bytes() const {
+        return louds.size() * sizeof(uint64_t) + rankSamples.size() * sizeof(uint32_t) +
+               selectSamples.size() * sizeof(uint32_t) + labels.size() * sizeof(uint64_t) +
+               terminals.size() * sizeof(uint64_t);
+    }
+
+    bool SuccinctGaddag::contains(const std::string& word) const {
+        // The path REVERSE(WORD) + is terminal exactly for words of the lexicon
+        Cursor node = rootCursor();
+        for (auto it = word.rbegin(); it != word.rend(); ++it) {
+            if (!child(node, (char)std::toupper((unsigned char)*it), node)) return false;
+        }
+        return child(node, GADDAG_DELIMITER, node) && isTerminal(node);
+    }
+
+    template <typename T>
+    static void writeVector(std::ofstream& out, const std::vector<T>& v) {
+        out.write(reinterpret_cast<const char*>(v.data()), (std::streamsize)(v.size() * sizeof(T)));
+    }
+
+    template <typename T>
+    static bool readVector(std::ifstream& in, std::vector<T>& v, uint32_t count) {
+        v.resize(count);
+        in.read(reinterpret_cast<char*>(v.data()), (std::streamsize)(count * sizeof(T)));
+        return (bool)in;
+    }
+
+    bool SuccinctGaddag::saveBinary(const std::string& filePath) const {
+        std::ofstream out(filePath, std::ios::binary);
+        if (!out.is_open()) {
+            std::cerr << "Error opening file for writing: " << filePath << std::endl;
+            return false;
+        }
+        SuccinctHeader header;
+        std::memset(&header, 0, sizeof(header));
+        std::memcpy(header.magic, SUCCINCT_MAGIC, sizeof(header.magic));
+        header.nodes = nodes;
+        header.words = words;
+        header.bits = (uint64_t)nodes * 2 - 1;
+        header.loudsWords = (uint32_t)louds.size();
+        header.rankCount = (uint32_t)rankSamples.size();
+        header.selectCount = (uint32_t)selectSamples.size();
+        header.labelWords = (uint32_t)labels.size();
+        header.terminalWords = (uint32_t)terminals.size();
+        out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        writeVector(out, louds);
+        writeVector(out, rankSamples);
+        writeVector(out, selectSamples);
+        writeVector(out, labels);
+        writeVector(out, terminals);
+        return out.good();
+    }
+
+    bool SuccinctGaddag::loadBinary(const std::string& filePath) {
+        std::ifstream in(filePath, std::ios::binary | std::ios::ate);
+        if (!in.is_open()) {
+            std::cerr << "Error opening file for reading: " << filePath << std::endl;
+            return false;
+        }
+        uint64_t fileSize = (uint64_t)in.tellg();
+        in.seekg(0);
+        SuccinctHeader header;
+        in.read(reinterpret_cast<char*>(&header), sizeof(header));
+        bool ok = in && std::memcmp(header.magic, SUCCINCT_MAGIC, sizeof(header.magic)) == 0 && header.nodes > 0 &&
+                  header.nodes <= (1u << 31) && header.bits == (uint64_t)header.nodes * 2 - 1 &&
+                  header.loudsWords > header.bits / 64 && header.rankCount > header.bits / BLOCK_BITS &&
+                  header.selectCount >= (header.nodes + SELECT_STEP - 1) / SELECT_STEP &&
+                  header.labelWords * (uint64_t)LABELS_PER_WORD >= header.nodes &&
+                  header.terminalWords * 64ull >= header.nodes;
+        // Sizes are checked against the file before anything is allocated
+        uint64_t samples = ((uint64_t)header.rankCount + header.selectCount) * sizeof(uint32_t);
+        ok = ok && fileSize == sizeof(header) + samples +
+                  ((uint64_t)header.loudsWords + header.labelWords + header.terminalWords) * sizeof(uint64_t);
+
+        // The rank and select samples are derived from louds: rebuild them rather than trust the file
+        ok = ok && readVector(in, louds, header.loudsWords) && in.seekg((std::streamoff)samples, std::ios::cur) &&
+             readVector(in, labels, header.labelWords) && readVector(in, terminals, header.terminalWords);
+        if (ok) buildIndex(header.bits);
+
+        // A well-formed sequence has one 1 per edge and one 0 per node, ends with the last
+        // node's 0 and has nothing set past it: every block then ends inside the sequence
+        // and every child id is below nodes. Labels must be letters or the delimiter.
+        if (ok) {
+            uint64_t ones = 0;
+            for (uint64_t word : louds) ones += popcount(word);
+            ok = ones == header.nodes - 1 && rank1((uint32_t)header.bits) == ones &&
+                 !((louds[(header.bits - 1) / 64] >> ((header.bits - 1) % 64)) & 1u);
+        }
+        for (uint32_t edge = 0; ok && edge + 1 < header.nodes; ++edge) ok = label(edge) <= DELIMITER_CODE;
+
+        if (!ok) {
+            std::cerr << "Malformed succinct GADDAG: " << filePath << std::endl;
+            *this = SuccinctGaddag();
+            return false;
+        }
+        nodes = header.nodes;
+        words = header.words;
+        return true;
+    }
+
+}
@@ -0,0 +1,178 @@
+#ifndef SUCCINCT_GADDAG_H
+#define SUCCINCT_GADDAG_H
+
+#include "Gaddag.h"
+#include <vector>
+#include <string>
+#include <algorithm>
+#include <cstdint>
+
+namespace Scrabble {
+
+    /*
+     * Read-only GADDAG in a few bits per node, for keeping many lexicons resident.
+     *
+     * The graph is stored in level order (LOUDS): every node, in breadth-first
+     * order, writes a 1 bit per child followed by a 0. Node ids are breadth-first
+     * ranks (root = 0), so the children of a node have consecutive ids: the first
+     * is 1 + the number of 1 bits before the node's block (rank1), and the block of
+     * node v starts just after the v-th 0 (select0(v - 1) + 1).
+     *
+     * Edge labels are 5-bit codes (A-Z, then the delimiter), 12 to a 64-bit word,
+     * indexed by child id - 1 and sorted within each node. Terminal flags take one
+     * bit per node. rank1 reads a count stored every 512 bits plus a few popcounts;
+     * select0 starts from a position sampled every 512 zeros.
+     *
+     * Offers the traversal interface of Gaddag (Cursor, rootCursor, child,
+     * forEachChild, isTerminal, contains), so MoveGenerator runs on either and
+     * finds the same moves. Immutable once built or loaded: safe to share between threads.
+     *
+     * File layout (little-endian): SuccinctHeader, then louds, rankSamples,
+     * selectSamples, labels and terminals, each as the number of entries the header gives.
+     */
+    class SuccinctGaddag {
+    public:
+        // A node is its breadth-first id
+        using Cursor = uint32_t;
+
+    private:
+        static const uint32_t BLOCK_BITS = 512;     // Bits per rank sample
+        static const uint32_t SELECT_STEP = 512;    // Zeros per select sample
+        static const uint32_t LABELS_PER_WORD = 12;
+        static const uint32_t DELIMITER_CODE = 26;
+
+        std::vector<uint64_t> louds;            // 1^degree 0 for each node, breadth-first
+        std::vector<uint32_t> rankSamples;      // Ones before each BLOCK_BITS block
+        std::vector<uint32_t> selectSamples;    // Position of zero number k * SELECT_STEP
+        std::vector<uint64_t> labels;           // Edge codes by child id - 1
+        std::vector<uint64_t> terminals;        // Terminal flag by node id
+        uint32_t nodes;
+        uint32_t words;
+
+        // Rebuild rankSamples and selectSamples from louds
+        void buildIndex(uint64_t bits);
+
+        static uint32_t popcount(uint64_t x) { return (uint32_t)__builtin_popcountll(x); }
+
+        // Ones in louds[0, position)
+        uint32_t rank1(uint32_t position) const {
+            uint32_t block = position / BLOCK_BITS;
+            uint32_t ones = rankSamples[block];
+            for (uint32_t w = block * (BLOCK_BITS / 64); w < position / 64; ++w) ones += popcount(louds[w]);
+            if (position % 64) ones += popcount(louds[position / 64] & ((1ull << (position % 64)) - 1));
+            return ones;
+        }
+
+        // Position of the k-th zero of louds (k from 0)
+        uint32_t select0(uint32_t k) const {
+            uint32_t start = selectSamples[k / SELECT_STEP];
+            uint32_t skip = k % SELECT_STEP;
+            uint32_t w = start / 64;
+            uint64_t zeros = ~louds[w] & (~0ull << (start % 64));
+            for (uint32_t count = popcount(zeros); skip >= count; count = popcount(zeros)) {
+                skip -= count;
+                zeros = ~louds[++w];
+            }
+            // skip-th set bit of zeros: find its byte, then clear the lower bits
+            uint32_t base = 0;
+            for (uint32_t count = popcount(zeros & 0xFF); skip >= count; count = popcount(zeros & 0xFF)) {
+                skip -= count;
+                zeros >>= 8;
+                base += 8;
+            }
+            for (; skip > 0; --skip) zeros &= zeros - 1;
+            return w * 64 + base + (uint32_t)__builtin_ctzll(zeros);
+        }
+
+        // Start of a node's child block in louds
+        uint32_t block(Cursor node) const { return node == 0 ? 0 : select0(node - 1) + 1; }
+
+        // Number of 1 bits starting at a block position
+        uint32_t degree(uint32_t position) const {
+            uint32_t count = 0;
+            for (;;) {
+                uint64_t run = ~(louds[position / 64] >> (position % 64));
+                uint32_t available = 64 - position % 64;
+                uint32_t ones = run ? std::min<uint32_t>((uint32_t)__builtin_ctzll(run), available) : available;
+                count += ones;
+                if (ones < available) return count;
+                position += ones;
+            }
+        }
+
+        uint32_t label(uint32_t edge) const {
+            return (uint32_t)(labels[edge / LABELS_PER_WORD] >> (edge % LABELS_PER_WORD * 5)) & 31u;
+        }
+
+        static uint32_t code(char letter) {
+            if (letter >= 'A' && letter <= 'Z') return (uint32_t)(letter - 'A');
+            return letter == GADDAG_DELIMITER ? DELIMITER_CODE : 32u;
+        }
+
+        static char letterOf(uint32_t code) { return code == DELIMITER_CODE ? GADDAG_DELIMITER : (char)('A' + code); }
+
+    public:
+        SuccinctGaddag();
+
+        /**
+         * Encode a loaded GADDAG. The source can be released afterwards.
+         * @param gaddag Pointer-based GADDAG
+         */
+        explicit SuccinctGaddag(const Gaddag& gaddag);
+
+        /**
+         * Save to a binary file (see the layout above).
+         * @return false on I/O error
+         */
+        bool saveBinary(const std::string& filePath) const;
+
+        /**
+         * Load a file written by saveBinary. The sequence and labels are checked for
+         * consistency and the rank/select samples are rebuilt, not read.
+         * @return false on I/O error or a malformed file (the dictionary is then empty)
+         */
+        bool loadBinary(const std::string& filePath);
+
+        uint32_t nodeCount() const { return nodes; }
+        uint32_t wordCount() const { return words; }
+
+        /**
+         * Memory held by the encoding, in bytes.
+         */
+        size_t bytes() const;
+
+        // Traversal interface, as in Gaddag
+
+        Cursor rootCursor() const { return 0; }
+
+        bool isTerminal(Cursor node) const { return (terminals[node / 64] >> (node % 64)) & 1u; }
+
+        bool child(Cursor node, char letter, Cursor& next) const {
+            uint32_t wanted = code(letter);
+            uint32_t start = block(node);
+            uint32_t first = rank1(start) + 1;
+            uint32_t count = degree(start);
+            for (uint32_t i = 0; i < count; ++i) {
+                uint32_t c = label(first - 1 + i);
+                if (c < wanted) continue;
+                if (c > wanted) return false;
+                next = first + i;
+                return true;
+            }
+            return false;
+        }
+
+        template <typename F>
+        void forEachChild(Cursor node, F f) const {
+            uint32_t start = block(node);
+            uint32_t first = rank1(start) + 1;
+            uint32_t count = degree(start);
+            for (uint32_t i = 0; i < count; ++i) f(letterOf(label(first - 1 + i)), first + i);
+        }
+
+        bool contains(const std::string& word) const;
+    };
+
+}
+
+#endif // SUCCINCT_GADDAG_H
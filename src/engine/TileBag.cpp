@@ -0,0 +1,45 @@
+#include "TileBag.h"
+#include "Rules.h"
+#include <algorithm>
+
+namespace Scrabble {
+
+    TileBag::TileBag(uint64_t seed) : TileBag(seed, FrenchRules::COUNTS, FrenchRules::BLANKS) {}
+
+    TileBag::TileBag(uint64_t seed, const int counts[26], int blanks) : rng(seed) {
+        for (int l = 0; l < 26; ++l) {
+            tiles.insert(tiles.end(), counts[l], (char)('A' + l));
+        }
+        tiles.insert(tiles.end(), blanks, BLANK_TILE);
+    }
+
+    void TileBag::refill(std::vector<char>& rack, size_t target) {
+        // Draw uniformly by swapping a random tile to the back and popping it
+        while (rack.size() < target && !tiles.empty()) {
+            std::uniform_int_distribution<size_t> dist(0, tiles.size() - 1);
+            size_t idx = dist(rng);
+            std::swap(tiles[idx], tiles.back());
+            rack.push_back(tiles.back());
+            tiles.pop_back();
+        }
+    }
+
+    bool TileBag::exchange(std::vector<char>& rack, const std::vector<char>& toExchange) {
+        if (tiles.size() < (size_t)RACK_SIZE || toExchange.empty()) return false;
+
+        std::vector<char> remaining = rack;
+        for (char c : toExchange) {
+            auto it = std::find(remaining.begin(), remaining.end(), c);
+            if (it == remaining.end()) return false;
+            remaining.erase(it);
+        }
+
+        // Draw replacements before returning the old tiles, as the rules require
+        size_t target = rack.size();
+        refill(remaining, target);
+        tiles.insert(tiles.end(), toExchange.begin(), toExchange.end());
+        rack = remaining;
+        return true;
+    }
+
+}
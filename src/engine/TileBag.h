@@ -0,0 +1,59 @@
+#ifndef TILE_BAG_H
+#define TILE_BAG_H
+
+#include <vector>
+#include <cstdint>
+#include <random>
+
+namespace Scrabble {
+
+    /**
+     * The bag of undrawn tiles, filled with the French distribution (102 tiles) unless
+     * another one is given (see Ruleset.h).
+     * Each bag owns its own RNG so that games seeded identically replay identically,
+     * regardless of which thread runs them.
+     */
+    class TileBag {
+    private:
+        std::vector<char> tiles;
+        std::mt19937_64 rng;
+
+    public:
+        /**
+         * Create a full, shuffled bag.
+         * @param seed RNG seed for draws
+         */
+        explicit TileBag(uint64_t seed);
+
+        /**
+         * Create a full, shuffled bag with another tile distribution,
+         * e.g. TileBag(seed, EnglishRules::COUNTS, EnglishRules::BLANKS).
+         * @param seed RNG seed for draws
+         * @param counts Tiles of each letter, by letter - 'A'
+         * @param blanks Blank tiles
+         */
+        TileBag(uint64_t seed, const int counts[26], int blanks);
+
+        /**
+         * Draw tiles into a rack until it holds `target` tiles or the bag is empty.
+         * @param rack Rack to refill
+         * @param target Desired rack size (usually RACK_SIZE)
+         */
+        void refill(std::vector<char>& rack, size_t target);
+
+        /**
+         * Return tiles to the bag and draw the same number of replacements.
+         * Only legal while the bag holds at least RACK_SIZE tiles.
+         * @param rack Rack holding the tiles
+         * @param toExchange Tiles to swap (must all be present in the rack)
+         * @return false if the exchange is not allowed
+         */
+        bool exchange(std::vector<char>& rack, const std::vector<char>& toExchange);
+
+        size_t size() const { return tiles.size(); }
+        bool empty() const { return tiles.empty(); }
+    };
+
+}
+
+#endif // TILE_BAG_H
@@ -0,0 +1,479 @@
+#include "TrainingData.h"
+#include "Rules.h"
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace Scrabble {
+
+    static const char TD_MAGIC[8] = {'S', 'C', 'R', 'B', 'T', 'D', '0', '1'};
+    static const uint32_t TD_HEADER_BYTES = 64;
+    static const uint32_t TD_CHUNK_HEADER_BYTES = 32;
+    static const uint32_t TD_CHUNK_MAGIC = 0x4B4E4843; // "CHNK"
+
+    // Byte width of each column, per table
+    static const uint32_t POSITION_WIDTHS[(int)PositionColumn::Count] = {
+        TD_BOARD_BYTES, TD_RACK_BYTES, 4, 2, 1, 1, 4, 2
+    };
+    static const uint32_t MOVE_WIDTHS[(int)MoveColumn::Count] = {
+        4, TD_FEATURE_BYTES, TD_WORD_BYTES, 2, TD_RACK_BYTES, 1
+    };
+
+    struct FileHeader {
+        char magic[8];
+        uint32_t version;
+        uint32_t chunkRows;
+        uint32_t chunkAlign;
+        uint8_t reserved[44];
+    };
+
+    struct ChunkHeader {
+        uint32_t magic;
+        uint32_t table;
+        uint32_t rows;
+        uint32_t reserved;
+        uint64_t firstRow;
+        uint64_t reserved2;
+    };
+
+    struct ChunkIndexEntry {
+        uint32_t table;
+        uint32_t rows;
+        uint64_t firstRow;
+        uint64_t offset;
+    };
+
+    struct FileFooter {
+        uint64_t indexOffset;
+        uint32_t chunkCount;
+        uint32_t chunkRows;
+        uint64_t positions;
+        uint64_t moves;
+    };
+
+    static_assert(sizeof(FileHeader) == TD_HEADER_BYTES, "FileHeader layout");
+    static_assert(sizeof(ChunkHeader) == TD_CHUNK_HEADER_BYTES, "ChunkHeader layout");
+    static_assert(sizeof(ChunkIndexEntry) == 24, "ChunkIndexEntry layout");
+    static_assert(sizeof(FileFooter) == 32, "FileFooter layout");
+
+    static const uint32_t* tableWidths(TrainingTable table) {
+        return table == TrainingTable::Positions ? POSITION_WIDTHS : MOVE_WIDTHS;
+    }
+
+    static int tableColumns(TrainingTable table) {
+        return table == TrainingTable::Positions ? (int)PositionColumn::Count : (int)MoveColumn::Count;
+    }
+
+    // Offset of a column inside a chunk
+    static uint64_t columnOffset(TrainingTable table, int column, uint32_t chunkRows) {
+        const uint32_t* widths = tableWidths(table);
+        uint64_t off = TD_CHUNK_HEADER_BYTES;
+        for (int c = 0; c < column; ++c) off += (uint64_t)widths[c] * chunkRows;
+        return off;
+    }
+
+    static uint64_t alignUp(uint64_t value, uint64_t align) {
+        return (value + align - 1) / align * align;
+    }
+
+    static uint64_t chunkBytes(TrainingTable table, uint32_t chunkRows) {
+        return alignUp(columnOffset(table, tableColumns(table), chunkRows), TD_CHUNK_ALIGN);
+    }
+
+    // --- Record helpers ---
+
+    void encodeBoardBytes(const Board& board, uint8_t out[TD_BOARD_BYTES]) {
+        for (int r = 0; r < 15; ++r) {
+            for (int c = 0; c < 15; ++c) {
+                Tile t = board.getTile(r, c);
+                uint8_t code = 0;
+                if (!t.isEmpty()) {
+                    code = (uint8_t)(t.letter - 'A' + 1);
+                    if (t.isBlank()) code |= 0x80;
+                }
+                out[r * 15 + c] = code;
+            }
+        }
+    }
+
+    void encodeRackCounts(const std::vector<char>& rack, uint8_t out[TD_RACK_BYTES]) {
+        std::memset(out, 0, TD_RACK_BYTES);
+        for (char c : rack) {
+            if (isBlankTile(c)) out[26]++;
+            else if (c >= 'A' && c <= 'Z') out[c - 'A']++;
+        }
+    }
+
+    MoveRecord makeMoveRecord(const Move& move, const std::vector<char>& rack, uint32_t position, bool chosen) {
+        MoveRecord rec;
+        std::memset(&rec, 0, sizeof(rec));
+        rec.position = position;
+
+        int blanks = 0;
+        encodeRackCounts(rack, rec.leave);
+        for (int i = 0; i < move.tileCount; ++i) {
+            const Tile& t = move.tiles[i];
+            if (t.isBlank()) {
+                blanks++;
+                if (rec.leave[26] > 0) rec.leave[26]--;
+            } else if (t.letter >= 'A' && t.letter <= 'Z' && rec.leave[t.letter - 'A'] > 0) {
+                rec.leave[t.letter - 'A']--;
+            }
+        }
+
+        rec.features[FeatureRow] = (uint8_t)move.row;
+        rec.features[FeatureCol] = (uint8_t)move.col;
+        rec.features[FeatureHorizontal] = move.horizontal ? 1 : 0;
+        rec.features[FeatureTilesPlaced] = (uint8_t)move.tileCount;
+        rec.features[FeatureWordLength] = (uint8_t)move.word.length();
+        rec.features[FeatureBlanksUsed] = (uint8_t)blanks;
+        rec.features[FeatureBingo] = move.tileCount == RACK_SIZE ? 1 : 0;
+
+        size_t len = std::min(move.word.length(), (size_t)TD_WORD_BYTES);
+        std::memcpy(rec.word, move.word.data(), len);
+        rec.score = (int16_t)move.score;
+        rec.chosen = chosen ? 1 : 0;
+        return rec;
+    }
+
+    // --- Writer ---
+
+    TrainingWriter::TrainingWriter()
+        : chunkRows(0), maxQueued(0), offset(0), chunkCount(0), closing(false), failed(false) {
+        rowCounts[0] = rowCounts[1] = 0;
+    }
+
+    TrainingWriter::~TrainingWriter() {
+        if (worker.joinable()) close();
+    }
+
+    bool TrainingWriter::open(const std::string& path, uint32_t rowsPerChunk, size_t queueLimit) {
+        out.open(path, std::ios::binary | std::ios::trunc);
+        if (!out.is_open()) {
+            std::cerr << "Error opening training data file for writing: " << path << std::endl;
+            return false;
+        }
+
+        // Multiple of 8 keeps every column 8-byte aligned inside a chunk
+        chunkRows = (uint32_t)alignUp(std::max<uint32_t>(rowsPerChunk, 8), 8);
+        maxQueued = std::max<size_t>(queueLimit, 1);
+        rowCounts[0] = rowCounts[1] = 0;
+        chunkCount = 0;
+        index.clear();
+        closing = false;
+        failed = false;
+
+        for (int t = 0; t < 2; ++t) {
+            chunks[t].bytes.assign(chunkBytes((TrainingTable)t, chunkRows), 0);
+            chunks[t].rows = 0;
+            chunks[t].firstRow = 0;
+        }
+
+        FileHeader header;
+        std::memset(&header, 0, sizeof(header));
+        std::memcpy(header.magic, TD_MAGIC, sizeof(TD_MAGIC));
+        header.version = TD_VERSION;
+        header.chunkRows = chunkRows;
+        header.chunkAlign = TD_CHUNK_ALIGN;
+
+        // The header occupies the first aligned block so chunks start page aligned
+        std::vector<uint8_t> block(TD_CHUNK_ALIGN, 0);
+        std::memcpy(block.data(), &header, sizeof(header));
+        out.write(reinterpret_cast<const char*>(block.data()), block.size());
+        offset = block.size();
+
+        worker = std::thread(&TrainingWriter::run, this);
+        return true;
+    }
+
+    bool TrainingWriter::submit(GameRecord&& game) {
+        std::unique_lock<std::mutex> lock(queueMutex);
+        notFull.wait(lock, [this] { return queue.size() < maxQueued || closing || !out.is_open(); });
+        // Nothing would drain the queue: not opened yet, or closed (possibly while waiting)
+        if (closing || !out.is_open()) return false;
+        queue.push_back(std::move(game));
+        notEmpty.notify_one();
+        return true;
+    }
+
+    void TrainingWriter::run() {
+        for (;;) {
+            GameRecord game;
+            {
+                std::unique_lock<std::mutex> lock(queueMutex);
+                notEmpty.wait(lock, [this] { return !queue.empty() || closing; });
+                if (queue.empty()) return; // closing and drained
+                game = std::move(queue.front());
+                queue.pop_front();
+                notFull.notify_one();
+            }
+            append(game);
+        }
+    }
+
+    // Scatter one row into the column areas of a chunk
+    static void scatter(TrainingWriter::ChunkBuffer& chunk, TrainingTable table, uint32_t chunkRows,
+                        const void* const* fields) {
+        const uint32_t* widths = tableWidths(table);
+        uint64_t off = TD_CHUNK_HEADER_BYTES;
+        for (int c = 0; c < tableColumns(table); ++c) {
+            std::memcpy(&chunk.bytes[off + (uint64_t)chunk.rows * widths[c]], fields[c], widths[c]);
+            off += (uint64_t)widths[c] * chunkRows;
+        }
+        chunk.rows++;
+    }
+
+    void TrainingWriter::append(GameRecord& game) {
+        uint64_t positionBase = rowCounts[0];
+
+        for (const PositionRecord& p : game.positions) {
+            const void* fields[(int)PositionColumn::Count] = {
+                p.board, p.rack, &p.gameId, &p.turn, &p.player, &p.bagSize, p.scores, &p.outcome
+            };
+            scatter(chunks[0], TrainingTable::Positions, chunkRows, fields);
+            rowCounts[0]++;
+            if (chunks[0].rows == chunkRows) flushChunk(TrainingTable::Positions);
+        }
+
+        for (MoveRecord& m : game.moves) {
+            uint32_t globalPosition = (uint32_t)(positionBase + m.position);
+            const void* fields[(int)MoveColumn::Count] = {
+                &globalPosition, m.features, m.word, &m.score, m.leave, &m.chosen
+            };
+            scatter(chunks[1], TrainingTable::Moves, chunkRows, fields);
+            rowCounts[1]++;
+            if (chunks[1].rows == chunkRows) flushChunk(TrainingTable::Moves);
+        }
+    }
+
+    void TrainingWriter::flushChunk(TrainingTable table) {
+        ChunkBuffer& chunk = chunks[(int)table];
+        if (chunk.rows == 0) return;
+
+        ChunkHeader header;
+        std::memset(&header, 0, sizeof(header));
+        header.magic = TD_CHUNK_MAGIC;
+        header.table = (uint32_t)table;
+        header.rows = chunk.rows;
+        header.firstRow = chunk.firstRow;
+        std::memcpy(chunk.bytes.data(), &header, sizeof(header));
+
+        ChunkIndexEntry entry;
+        entry.table = (uint32_t)table;
+        entry.rows = chunk.rows;
+        entry.firstRow = chunk.firstRow;
+        entry.offset = offset;
+        const uint8_t* raw = reinterpret_cast<const uint8_t*>(&entry);
+        index.insert(index.end(), raw, raw + sizeof(entry));
+        chunkCount++;
+
+        out.write(reinterpret_cast<const char*>(chunk.bytes.data()), chunk.bytes.size());
+        if (!out) failed = true;
+        offset += chunk.bytes.size();
+
+        chunk.firstRow += chunk.rows;
+        chunk.rows = 0;
+        std::fill(chunk.bytes.begin(), chunk.bytes.end(), 0);
+    }
+
+    bool TrainingWriter::close() {
+        if (!worker.joinable()) return !failed;
+        {
+            std::lock_guard<std::mutex> lock(queueMutex);
+            closing = true;
+        }
+        notEmpty.notify_all();
+        notFull.notify_all();
+        worker.join();
+
+        flushChunk(TrainingTable::Positions);
+        flushChunk(TrainingTable::Moves);
+
+        FileFooter footer;
+        footer.indexOffset = offset;
+        footer.chunkCount = chunkCount;
+        footer.chunkRows = chunkRows;
+        footer.positions = rowCounts[0];
+        footer.moves = rowCounts[1];
+
+        out.write(reinterpret_cast<const char*>(index.data()), index.size());
+        out.write(reinterpret_cast<const char*>(&footer), sizeof(footer));
+        out.close();
+        if (out.fail()) failed = true;
+        return !failed;
+    }
+
+    // --- Reader ---
+
+    TrainingReader::TrainingReader() : base(nullptr), length(0), chunkRows(0) {
+        rowCounts[0] = rowCounts[1] = 0;
+    }
+
+    TrainingReader::~TrainingReader() {
+        close();
+    }
+
+    bool TrainingReader::open(const std::string& path) {
+        close();
+
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) {
+            std::cerr << "Error opening training data file for reading: " << path << std::endl;
+            return false;
+        }
+        struct stat st;
+        if (fstat(fd, &st) != 0 || (size_t)st.st_size < TD_HEADER_BYTES + sizeof(FileFooter)) {
+            ::close(fd);
+            return false;
+        }
+        void* map = mmap(nullptr, (size_t)st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+        ::close(fd);
+        if (map == MAP_FAILED) return false;
+        base = static_cast<const uint8_t*>(map);
+        length = (size_t)st.st_size;
+
+        FileHeader header;
+        std::memcpy(&header, base, sizeof(header));
+        FileFooter footer;
+        std::memcpy(&footer, base + length - sizeof(footer), sizeof(footer));
+        uint64_t indexEnd = length - sizeof(footer);
+        bool valid = std::memcmp(header.magic, TD_MAGIC, sizeof(TD_MAGIC)) == 0 && header.version == TD_VERSION &&
+                     footer.chunkRows != 0 && footer.chunkRows == header.chunkRows &&
+                     footer.indexOffset >= TD_HEADER_BYTES && footer.indexOffset <= indexEnd &&
+                     footer.chunkCount <= (indexEnd - footer.indexOffset) / sizeof(ChunkIndexEntry);
+
+        // Every chunk must lie before the index, and each table's chunks must cover
+        // its rows in order, so column() can address any row without further checks
+        uint64_t nextRow[2] = {0, 0};
+        for (uint32_t i = 0; valid && i < footer.chunkCount; ++i) {
+            ChunkIndexEntry entry;
+            std::memcpy(&entry, base + footer.indexOffset + i * sizeof(entry), sizeof(entry));
+            valid = entry.table < 2 && entry.rows != 0 && entry.rows <= footer.chunkRows &&
+                    entry.offset >= TD_HEADER_BYTES && entry.offset <= footer.indexOffset &&
+                    chunkBytes((TrainingTable)entry.table, footer.chunkRows) <= footer.indexOffset - entry.offset &&
+                    entry.firstRow == nextRow[entry.table];
+            if (!valid) break;
+            nextRow[entry.table] += entry.rows;
+            chunks[entry.table].push_back({entry.table, entry.rows, entry.firstRow, entry.offset});
+        }
+        if (!valid || nextRow[0] != footer.positions || nextRow[1] != footer.moves) {
+            std::cerr << "Invalid training data file: " << path << std::endl;
+            close();
+            return false;
+        }
+
+        chunkRows = footer.chunkRows;
+        rowCounts[0] = footer.positions;
+        rowCounts[1] = footer.moves;
+        return true;
+    }
+
+    void TrainingReader::close() {
+        if (base) munmap(const_cast<uint8_t*>(base), length);
+        base = nullptr;
+        length = 0;
+        chunks[0].clear();
+        chunks[1].clear();
+        rowCounts[0] = rowCounts[1] = 0;
+    }
+
+    const uint8_t* TrainingReader::column(TrainingTable table, int column, uint64_t row) const {
+        const std::vector<ChunkRef>& list = chunks[(int)table];
+        if (!base || column < 0 || column >= tableColumns(table) || row >= rowCounts[(int)table]) return nullptr;
+
+        // Chunks of one table are written in row order: binary search on firstRow
+        auto it = std::upper_bound(list.begin(), list.end(), row,
+            [](uint64_t r, const ChunkRef& c) { return r < c.firstRow; });
+        if (it == list.begin()) return nullptr;
+        --it;
+        if (row >= it->firstRow + it->rows) return nullptr;
+
+        uint64_t off = it->offset + columnOffset(table, column, chunkRows)
+                     + (row - it->firstRow) * tableWidths(table)[column];
+        return base + off;
+    }
+
+    bool TrainingReader::readPosition(uint64_t row, PositionRecord& out) const {
+        void* fields[(int)PositionColumn::Count] = {
+            out.board, out.rack, &out.gameId, &out.turn, &out.player, &out.bagSize, out.scores, &out.outcome
+        };
+        for (int c = 0; c < (int)PositionColumn::Count; ++c) {
+            const uint8_t* p = column(TrainingTable::Positions, c, row);
+            if (!p) return false;
+            std::memcpy(fields[c], p, POSITION_WIDTHS[c]);
+        }
+        return true;
+    }
+
+    bool TrainingReader::readMove(uint64_t row, MoveRecord& out) const {
+        void* fields[(int)MoveColumn::Count] = {
+            &out.position, out.features, out.word, &out.score, out.leave, &out.chosen
+        };
+        for (int c = 0; c < (int)MoveColumn::Count; ++c) {
+            const uint8_t* p = column(TrainingTable::Moves, c, row);
+            if (!p) return false;
+            std::memcpy(fields[c], p, MOVE_WIDTHS[c]);
+        }
+        return true;
+    }
+
+    // --- Self-play recorder ---
+
+    void TrainingRecorder::onGameStart(const Game&, uint64_t gameIndex) {
+        current.positions.clear();
+        current.moves.clear();
+        gameId = (uint32_t)gameIndex;
+    }
+
+    void TrainingRecorder::onTurn(const Game& game, const std::vector<Move>& moves, int chosen) {
+        PositionRecord pos;
+        std::memset(&pos, 0, sizeof(pos));
+        const std::vector<char>& rack = game.getRack(game.currentPlayer());
+        encodeBoardBytes(game.getBoard(), pos.board);
+        encodeRackCounts(rack, pos.rack);
+        pos.gameId = gameId;
+        pos.turn = (uint16_t)game.turnNumber();
+        pos.player = (uint8_t)game.currentPlayer();
+        pos.bagSize = (uint8_t)game.bagSize();
+        pos.scores[0] = (int16_t)game.getScore(0);
+        pos.scores[1] = (int16_t)game.getScore(1);
+        uint32_t positionIndex = (uint32_t)current.positions.size();
+        current.positions.push_back(pos);
+
+        if (candidateLimit == 0 || moves.size() <= candidateLimit) {
+            for (size_t i = 0; i < moves.size(); ++i) {
+                current.moves.push_back(makeMoveRecord(moves[i], rack, positionIndex, (int)i == chosen));
+            }
+            return;
+        }
+
+        // Keep the best candidates by score, plus the played move
+        std::vector<int> order(moves.size());
+        for (size_t i = 0; i < moves.size(); ++i) order[i] = (int)i;
+        std::partial_sort(order.begin(), order.begin() + candidateLimit, order.end(),
+            [&moves](int a, int b) { return moves[a].score > moves[b].score; });
+        bool chosenKept = chosen < 0;
+        for (size_t k = 0; k < candidateLimit; ++k) {
+            int i = order[k];
+            if (i == chosen) chosenKept = true;
+            current.moves.push_back(makeMoveRecord(moves[i], rack, positionIndex, i == chosen));
+        }
+        if (!chosenKept) {
+            current.moves.push_back(makeMoveRecord(moves[chosen], rack, positionIndex, true));
+        }
+    }
+
+    void TrainingRecorder::onGameEnd(const Game& game) {
+        for (PositionRecord& pos : current.positions) {
+            int me = pos.player;
+            pos.outcome = (int16_t)(game.getScore(me) - game.getScore(1 - me));
+        }
+        writer.submit(std::move(current));
+        current = GameRecord();
+    }
+
+}
@@ -0,0 +1,256 @@
+#ifndef TRAINING_DATA_H
+#define TRAINING_DATA_H
+
+#include "engine.h"
+#include "SelfPlay.h"
+#include <vector>
+#include <string>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <condition_variable>
+#include <fstream>
+#include <cstdint>
+
+namespace Scrabble {
+
+    /*
+     * Training data file format (little-endian, all offsets in bytes):
+     *
+     *   FileHeader (64)            magic "SCRBTD01", version, rows per chunk
+     *   Chunk 0 .. Chunk N-1       each padded to TD_CHUNK_ALIGN
+     *   ChunkIndexEntry[N]         one entry per chunk
+     *   FileFooter (32)            offset of the index, chunk count, row totals
+     *
+     * Two tables are stored: positions (one row per turn) and moves (one row per
+     * candidate move). A chunk holds up to `chunkRows` rows of a single table,
+     * laid out column by column: every column has room for `chunkRows` values,
+     * so a column's offset inside a chunk only depends on the table schema.
+     * Readers mmap the file, load the index and address any (table, column, row).
+     */
+
+    const uint32_t TD_VERSION = 1;
+    const uint32_t TD_CHUNK_ALIGN = 4096;
+    const int TD_BOARD_BYTES = 225;  // 0 = empty, 1..26 = letter, | 0x80 = blank
+    const int TD_RACK_BYTES = 27;    // Tile counts A..Z, then blanks
+    const int TD_FEATURE_BYTES = 8;  // See MoveFeature
+    const int TD_WORD_BYTES = 16;    // Main word, zero padded
+
+    enum class TrainingTable : uint32_t {
+        Positions = 0,
+        Moves = 1
+    };
+
+    enum class PositionColumn {
+        Board = 0,      // uint8[225]
+        Rack,           // uint8[27], rack of the player to move
+        GameId,         // uint32
+        Turn,           // uint16
+        Player,         // uint8, player to move
+        BagSize,        // uint8
+        Scores,         // int16[2], scores before the move
+        Outcome,        // int16, final margin from the mover's point of view
+        Count
+    };
+
+    enum class MoveColumn {
+        Position = 0,   // uint32, row in the positions table
+        Features,       // uint8[8], see MoveFeature
+        Word,           // uint8[16]
+        Score,          // int16
+        Leave,          // uint8[27], rack counts left after the move
+        Chosen,         // uint8, 1 if this move was played
+        Count
+    };
+
+    // Layout of the MoveColumn::Features bytes
+    enum MoveFeature {
+        FeatureRow = 0,
+        FeatureCol,
+        FeatureHorizontal,
+        FeatureTilesPlaced,
+        FeatureWordLength,
+        FeatureBlanksUsed,
+        FeatureBingo,
+        FeatureReserved
+    };
+
+    struct PositionRecord {
+        uint8_t board[TD_BOARD_BYTES];
+        uint8_t rack[TD_RACK_BYTES];
+        uint32_t gameId;
+        uint16_t turn;
+        uint8_t player;
+        uint8_t bagSize;
+        int16_t scores[2];
+        int16_t outcome;
+    };
+
+    struct MoveRecord {
+        uint32_t position;  // Index into GameRecord::positions until submitted
+        uint8_t features[TD_FEATURE_BYTES];
+        uint8_t word[TD_WORD_BYTES];
+        int16_t score;
+        uint8_t leave[TD_RACK_BYTES];
+        uint8_t chosen;
+    };
+
+    // All rows produced by one game; move rows reference positions of the same game
+    struct GameRecord {
+        std::vector<PositionRecord> positions;
+        std::vector<MoveRecord> moves;
+    };
+
+    // Encode a board as TD_BOARD_BYTES letter codes
+    void encodeBoardBytes(const Board& board, uint8_t out[TD_BOARD_BYTES]);
+
+    // Encode a rack as TD_RACK_BYTES tile counts
+    void encodeRackCounts(const std::vector<char>& rack, uint8_t out[TD_RACK_BYTES]);
+
+    /**
+     * Build the move row for a candidate move.
+     * @param move Scored move with resolved tiles
+     * @param rack Rack the move is played from (used for the leave)
+     * @param position Row of the position this move belongs to
+     * @param chosen Whether the move was played
+     */
+    MoveRecord makeMoveRecord(const Move& move, const std::vector<char>& rack, uint32_t position, bool chosen);
+
+    /**
+     * Streaming writer for the columnar training format.
+     * submit() is thread-safe and cheap: games are queued and a background thread
+     * scatters them into column chunks and writes full chunks with large sequential writes.
+     *
+     * Usage:
+     *   TrainingWriter writer;
+     *   writer.open("games.td");
+     *   writer.submit(std::move(gameRecord));   // from any thread
+     *   writer.close();                          // writes the index
+     */
+    class TrainingWriter {
+    public:
+        struct ChunkBuffer {
+            std::vector<uint8_t> bytes;
+            uint32_t rows;
+            uint64_t firstRow;
+        };
+
+    private:
+        std::ofstream out;
+        uint32_t chunkRows;
+        size_t maxQueued;
+        uint64_t offset;
+        uint64_t rowCounts[2];
+        ChunkBuffer chunks[2];
+        std::vector<uint8_t> index;
+        uint32_t chunkCount;
+
+        std::deque<GameRecord> queue;
+        std::mutex queueMutex;
+        std::condition_variable notEmpty;
+        std::condition_variable notFull;
+        bool closing;
+        bool failed;
+        std::thread worker;
+
+        void run();
+        void append(GameRecord& game);
+        void flushChunk(TrainingTable table);
+
+    public:
+        TrainingWriter();
+        ~TrainingWriter();
+
+        /**
+         * Create the output file and start the writer thread.
+         * @param path Output path
+         * @param rowsPerChunk Rows per chunk (same for both tables)
+         * @param queueLimit Maximum games waiting to be written before submit() blocks
+         * @return false if the file cannot be created
+         */
+        bool open(const std::string& path, uint32_t rowsPerChunk = 4096, size_t queueLimit = 256);
+
+        /**
+         * Queue a finished game. Blocks while the queue is full.
+         * @return false if the writer is not open (or was closed), the game is dropped
+         */
+        bool submit(GameRecord&& game);
+
+        /**
+         * Drain the queue, write the last chunks, the index and the footer.
+         * @return false if any write failed
+         */
+        bool close();
+
+        uint64_t positionsWritten() const { return rowCounts[0]; }
+        uint64_t movesWritten() const { return rowCounts[1]; }
+    };
+
+    /**
+     * Memory-mapped reader for files produced by TrainingWriter.
+     * Column accessors return pointers straight into the mapping (no copies).
+     */
+    class TrainingReader {
+    public:
+        struct ChunkRef {
+            uint32_t table;
+            uint32_t rows;
+            uint64_t firstRow;
+            uint64_t offset;
+        };
+
+    private:
+        const uint8_t* base;
+        size_t length;
+        uint32_t chunkRows;
+        uint64_t rowCounts[2];
+        std::vector<ChunkRef> chunks[2];
+
+    public:
+        TrainingReader();
+        ~TrainingReader();
+
+        bool open(const std::string& path);
+        void close();
+
+        uint64_t positionCount() const { return rowCounts[0]; }
+        uint64_t moveCount() const { return rowCounts[1]; }
+
+        /**
+         * Address of one value of a column.
+         * @param table Table to read
+         * @param column Column index (PositionColumn / MoveColumn)
+         * @param row Global row number in that table
+         * @return Pointer into the mapping, or nullptr if out of range
+         */
+        const uint8_t* column(TrainingTable table, int column, uint64_t row) const;
+
+        // Copy a full row into a record struct
+        bool readPosition(uint64_t row, PositionRecord& out) const;
+        bool readMove(uint64_t row, MoveRecord& out) const;
+    };
+
+    /**
+     * Self-play observer that turns each game into a GameRecord and submits it
+     * to a writer. Optionally keeps only the best `candidateLimit` candidates
+     * per turn (the played move is always kept).
+     */
+    class TrainingRecorder : public GameObserver {
+    private:
+        TrainingWriter& writer;
+        size_t candidateLimit;
+        GameRecord current;
+        uint32_t gameId;
+
+    public:
+        TrainingRecorder(TrainingWriter& writer, size_t candidateLimit = 0)
+            : writer(writer), candidateLimit(candidateLimit), gameId(0) {}
+
+        void onGameStart(const Game& game, uint64_t gameIndex) override;
+        void onTurn(const Game& game, const std::vector<Move>& moves, int chosen) override;
+        void onGameEnd(const Game& game) override;
+    };
+
+}
+
+#endif // TRAINING_DATA_H
@@ -0,0 +1,217 @@
+#include "Validation.h"
+#include "Rules.h"
+#include <cctype>
+
+namespace Scrabble {
+
+    const char* moveErrorName(MoveError error) {
+        switch (error) {
+            case MoveError::None: return "none";
+            case MoveError::BadPlacement: return "bad_placement";
+            case MoveError::EmptyPlacement: return "empty_placement";
+            case MoveError::TooManyTiles: return "too_many_tiles";
+            case MoveError::OccupiedSquare: return "occupied_square";
+            case MoveError::NotInLine: return "not_in_line";
+            case MoveError::Gap: return "gap";
+            case MoveError::MissingCenter: return "missing_center";
+            case MoveError::NotConnected: return "not_connected";
+            case MoveError::TooShort: return "too_short";
+            case MoveError::NotInRack: return "not_in_rack";
+            case MoveError::InvalidWord: return "invalid_word";
+            default: return "unknown";
+        }
+    }
+
+    bool isWord(const Gaddag& gaddag, const char* word, size_t length) {
+        // Canonical path: the word reversed, then the delimiter
+        const Node* node = gaddag.getRoot();
+        for (size_t i = length; i-- > 0;) {
+            auto it = node->children.find(word[i]);
+            if (it == node->children.end()) return false;
+            node = it->second;
+        }
+        auto it = node->children.find(GADDAG_DELIMITER);
+        return it != node->children.end() && it->second->isTerminal;
+    }
+
+    // Board with the placement overlaid: placed tiles first, then existing ones
+    struct Overlay {
+        const Board& board;
+        const Tile* placed;  // 225 squares, empty where nothing is placed
+
+        bool occupied(int r, int c) const {
+            if (r < 0 || r >= 15 || c < 0 || c >= 15) return false;
+            return !placed[r * 15 + c].isEmpty() || !board.isEmpty(r, c);
+        }
+        bool isNew(int r, int c) const { return !placed[r * 15 + c].isEmpty(); }
+        Tile tile(int r, int c) const { return isNew(r, c) ? placed[r * 15 + c] : board.getTile(r, c); }
+    };
+
+    static MoveValidation failure(MoveError error, const std::string& detail = std::string()) {
+        MoveValidation result;
+        result.error = error;
+        result.detail = detail;
+        return result;
+    }
+
+    static std::string square(int r, int c) {
+        return std::to_string(r) + " " + std::to_string(c);
+    }
+
+    // Reads the word through (r, c) along a direction and scores it; false if it is a single letter
+    static bool scoreWord(const Overlay& overlay, int r, int c, bool horizontal, WordScore& out) {
+        int dr = horizontal ? 0 : 1;
+        int dc = horizontal ? 1 : 0;
+        while (overlay.occupied(r - dr, c - dc)) { r -= dr; c -= dc; }
+
+        out.word.clear();
+        out.row = r;
+        out.col = c;
+        out.horizontal = horizontal;
+        int sum = 0;
+        int multiplier = 1;
+        for (; overlay.occupied(r, c); r += dr, c += dc) {
+            Tile t = overlay.tile(r, c);
+            out.word += (char)std::toupper(t.letter);
+            int letterScore = t.isBlank() ? 0 : letterValue((char)std::toupper(t.letter));
+            if (overlay.isNew(r, c)) {
+                // Premiums only count under new tiles
+                switch (overlay.board.getBonus(r, c)) {
+                    case Bonus::DoubleLetter: letterScore *= 2; break;
+                    case Bonus::TripleLetter: letterScore *= 3; break;
+                    case Bonus::DoubleWord: multiplier *= 2; break;
+                    case Bonus::TripleWord: multiplier *= 3; break;
+                    default: break;
+                }
+            }
+            sum += letterScore;
+        }
+        out.score = sum * multiplier;
+        return out.word.length() >= 2;
+    }
+
+    static bool rackSupplies(const std::vector<char>& rack, const Tile* placed, const int* squares, int count) {
+        int letters[26] = {};
+        int blanks = 0;
+        for (char c : rack) {
+            if (isBlankTile(c)) blanks++;
+            else if (c >= 'A' && c <= 'Z') letters[c - 'A']++;
+            else if (c >= 'a' && c <= 'z') letters[c - 'a']++;
+        }
+        for (int i = 0; i < count; ++i) {
+            const Tile& t = placed[squares[i]];
+            if (t.isBlank()) {
+                if (--blanks < 0) return false;
+            } else if (--letters[t.letter - 'A'] < 0) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    static MoveValidation validate(const Board& board, const std::string& placement, const Gaddag& gaddag,
+                                   const std::vector<char>* rack) {
+        if (placement.length() != 225) return failure(MoveError::BadPlacement, "expected 225 characters");
+
+        // Placed tiles, in board order
+        Tile placed[225];
+        int squares[RACK_SIZE];
+        int count = 0;
+        for (int i = 0; i < 225; ++i) {
+            char ch = placement[i];
+            if (ch == '.') continue;
+            if (!std::isalpha((unsigned char)ch)) return failure(MoveError::BadPlacement, square(i / 15, i % 15));
+            if (count == RACK_SIZE) return failure(MoveError::TooManyTiles);
+            bool blank = std::islower((unsigned char)ch) != 0;
+            char letter = (char)std::toupper((unsigned char)ch);
+            placed[i] = Tile(letter, blank ? 0 : letterValue(letter));
+            squares[count++] = i;
+        }
+        if (count == 0) return failure(MoveError::EmptyPlacement);
+
+        for (int i = 0; i < count; ++i) {
+            int r = squares[i] / 15, c = squares[i] % 15;
+            if (!board.isEmpty(r, c)) return failure(MoveError::OccupiedSquare, square(r, c));
+        }
+
+        int firstRow = squares[0] / 15, firstCol = squares[0] % 15;
+        int lastRow = squares[count - 1] / 15, lastCol = squares[count - 1] % 15;
+        bool sameRow = firstRow == lastRow;
+        bool sameCol = true;
+        for (int i = 1; i < count; ++i) {
+            if (squares[i] % 15 != firstCol) sameCol = false;
+        }
+        if (!sameRow && !sameCol) return failure(MoveError::NotInLine);
+
+        Overlay overlay{board, placed};
+        if (sameRow) {
+            for (int c = firstCol; c <= lastCol; ++c) {
+                if (!overlay.occupied(firstRow, c)) return failure(MoveError::Gap, square(firstRow, c));
+            }
+        } else {
+            for (int r = firstRow; r <= lastRow; ++r) {
+                if (!overlay.occupied(r, firstCol)) return failure(MoveError::Gap, square(r, firstCol));
+            }
+        }
+
+        bool emptyBoard = true;
+        const Tile* tiles = board.tileData();
+        for (int i = 0; i < 225 && emptyBoard; ++i) {
+            if (!tiles[i].isEmpty()) emptyBoard = false;
+        }
+        if (emptyBoard) {
+            if (placed[7 * 15 + 7].isEmpty()) return failure(MoveError::MissingCenter);
+        } else {
+            bool connected = false;
+            for (int i = 0; i < count && !connected; ++i) {
+                int r = squares[i] / 15, c = squares[i] % 15;
+                connected = !board.getTile(r - 1, c).isEmpty() || !board.getTile(r + 1, c).isEmpty() ||
+                            !board.getTile(r, c - 1).isEmpty() || !board.getTile(r, c + 1).isEmpty();
+            }
+            if (!connected) return failure(MoveError::NotConnected);
+        }
+
+        // Main direction: along the line, or for a single tile the one that forms a word
+        bool horizontal = count > 1 ? sameRow : (overlay.occupied(firstRow, firstCol - 1) ||
+                                                 overlay.occupied(firstRow, firstCol + 1));
+        MoveValidation result;
+        WordScore word;
+        if (!scoreWord(overlay, firstRow, firstCol, horizontal, word)) return failure(MoveError::TooShort);
+
+        if (rack && !rackSupplies(*rack, placed, squares, count)) return failure(MoveError::NotInRack);
+
+        result.move.row = word.row;
+        result.move.col = word.col;
+        result.move.horizontal = horizontal;
+        result.move.word = word.word;
+        result.words.push_back(word);
+        for (int i = 0; i < count; ++i) {
+            int r = squares[i] / 15, c = squares[i] % 15;
+            // placed[] is in board order, which is also the order along the main word
+            result.move.tiles[i] = placed[squares[i]];
+            if (scoreWord(overlay, r, c, !horizontal, word)) result.words.push_back(word);
+        }
+        result.move.tileCount = count;
+
+        for (const WordScore& w : result.words) {
+            if (!isWord(gaddag, w.word.data(), w.word.length())) {
+                return failure(MoveError::InvalidWord, w.word);
+            }
+            result.score += w.score;
+        }
+        if (count == RACK_SIZE) result.bingoBonus = BINGO_BONUS;
+        result.score += result.bingoBonus;
+        result.move.score = result.score;
+        return result;
+    }
+
+    MoveValidation validateMove(const Board& board, const std::string& placement, const Gaddag& gaddag) {
+        return validate(board, placement, gaddag, nullptr);
+    }
+
+    MoveValidation validateMove(const Board& board, const std::string& placement, const Gaddag& gaddag,
+                                const std::vector<char>& rack) {
+        return validate(board, placement, gaddag, &rack);
+    }
+
+}
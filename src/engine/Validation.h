@@ -0,0 +1,89 @@
+#ifndef VALIDATION_H
+#define VALIDATION_H
+
+#include "engine.h"
+#include "Gaddag.h"
+#include <vector>
+#include <string>
+
+namespace Scrabble {
+
+    /*
+     * Single-move validation: checks one submitted placement without generating
+     * the full move list. Only the squares of the placement and of the words it
+     * forms are read, and each word is looked up directly in the GADDAG.
+     *
+     * A placement uses the 225-character board format holding only the new tiles
+     * ('.' elsewhere, upper case for regular tiles, lower case for blanks), as in
+     * the solver protocol (Server.h).
+     */
+
+    enum class MoveError {
+        None = 0,
+        BadPlacement,     // Not 225 characters, or a character other than '.', A-Z, a-z
+        EmptyPlacement,   // No tile placed
+        TooManyTiles,     // More tiles than a rack holds
+        OccupiedSquare,   // A tile is placed on an occupied square
+        NotInLine,        // Tiles are not on a single row or column
+        Gap,              // An empty square between the placed tiles
+        MissingCenter,    // First move does not cover the centre square
+        NotConnected,     // Move does not touch any tile already on the board
+        TooShort,         // No word of two letters or more is formed
+        NotInRack,        // The rack cannot supply the tiles
+        InvalidWord       // A formed word is not in the lexicon
+    };
+
+    // One word formed by a move, with its contribution to the score
+    struct WordScore {
+        std::string word;
+        int row;
+        int col;
+        bool horizontal;
+        int score;
+    };
+
+    struct MoveValidation {
+        MoveError error = MoveError::None;
+        std::string detail;             // Offending word or square ("row col"), if any
+        Move move;                      // The move with its tiles and total score (legal moves only)
+        std::vector<WordScore> words;   // Main word first, then cross-words in board order
+        int bingoBonus = 0;
+        int score = 0;                  // Sum of the words plus the bingo bonus
+
+        bool ok() const { return error == MoveError::None; }
+    };
+
+    /**
+     * Short name of an error ("not_connected", "invalid_word", ...).
+     */
+    const char* moveErrorName(MoveError error);
+
+    /**
+     * Check a placement against the board and the lexicon, and score it.
+     * Errors are reported in the order of the MoveError enum (geometry first,
+     * then words), so the first rule broken is the one returned.
+     * @param board Board before the move
+     * @param placement 225-character placement string
+     * @param gaddag Dictionary
+     * @return The error, or the move with its score breakdown
+     */
+    MoveValidation validateMove(const Board& board, const std::string& placement, const Gaddag& gaddag);
+
+    /**
+     * Same, also checking that the rack holds the placed tiles (a lower case
+     * letter needs a blank, '?' or '*').
+     */
+    MoveValidation validateMove(const Board& board, const std::string& placement, const Gaddag& gaddag,
+                                const std::vector<char>& rack);
+
+    /**
+     * Lexicon lookup that walks the GADDAG in place (no allocation).
+     * @param gaddag Dictionary
+     * @param word Upper case letters
+     * @param length Number of letters
+     */
+    bool isWord(const Gaddag& gaddag, const char* word, size_t length);
+
+}
+
+#endif // VALIDATION_H
@@ -1,93 +1,89 @@
 #include "engine.h"
 
 /**
- * Initialize the board with standard Scrabble bonus layout
+ * Standard Scrabble bonus layout (French and English boards are the same)
  */
-Board::Board() {
-    // Initialize all positions with no bonus
-    for (int row = 0; row < 15; row++) {
-        for (int col = 0; col < 15; col++) {
-            bonus_board[row][col] = Bonus::None;
+template <>
+const char* const BoardLayout<15>::ROWS[15] = {
+    "T..d...T...d..T",
+    ".D...t...t...D.",
+    "..D...d.d...D..",
+    "d..D...d...D..d",
+    "....D.....D....",
+    ".t...t...t...t.",
+    "..d...d.d...d..",
+    "T..d.......d..T",
+    "..d...d.d...d..",
+    ".t...t...t...t.",
+    "....D.....D....",
+    "d..D...d...D..d",
+    "..D...d.d...D..",
+    ".D...t...t...D.",
+    "T..d...T...d..T",
+};
+
+/**
+ * Super board: quadruple word in the corners, quadruple letters near them
+ */
+template <>
+const char* const BoardLayout<21>::ROWS[21] = {
+    "Q..d...T..d..T...d..Q",
+    ".D...t...d.d...t...D.",
+    "..D...q.......q...D..",
+    "d..D...d..t..d...D..d",
+    "....D...t...t...D....",
+    ".t...D...d.d...D...t.",
+    "..q...t...d...t...q..",
+    "T..d...T.....T...d..T",
+    "....t...d...d...t....",
+    ".d...d...D.D...d...d.",
+    "d..t..d.......d..t..d",
+    ".d...d...D.D...d...d.",
+    "....t...d...d...t....",
+    "T..d...T.....T...d..T",
+    "..q...t...d...t...q..",
+    ".t...D...d.d...D...t.",
+    "....D...t...t...D....",
+    "d..D...d..t..d...D..d",
+    "..D...q.......q...D..",
+    ".D...t...d.d...t...D.",
+    "Q..d...T..d..T...d..Q",
+};
+
+/**
+ * Bonus of a layout character
+ */
+static Bonus bonusFromLayout(char square) {
+    switch (square) {
+        case 'd': return Bonus::DoubleLetter;
+        case 't': return Bonus::TripleLetter;
+        case 'q': return Bonus::QuadrupleLetter;
+        case 'D': return Bonus::DoubleWord;
+        case 'T': return Bonus::TripleWord;
+        case 'Q': return Bonus::QuadrupleWord;
+        default: return Bonus::None;
+    }
+}
+
+/**
+ * Initialize the board with the bonus layout of its size
+ */
+template <int N>
+BasicBoard<N>::BasicBoard() {
+    for (int row = 0; row < N; row++) {
+        for (int col = 0; col < N; col++) {
+            bonus_board[row][col] = bonusFromLayout(BoardLayout<N>::ROWS[row][col]);
             tile_board[row][col] = Tile(); // Empty tile
         }
     }
-    
-    // Set up the standard Scrabble bonus layout
-    // Triple Word Score positions (corners and center)
-    bonus_board[0][0] = Bonus::TripleWord;
-    bonus_board[0][7] = Bonus::TripleWord;
-    bonus_board[0][14] = Bonus::TripleWord;
-    bonus_board[7][0] = Bonus::TripleWord;
-    bonus_board[7][14] = Bonus::TripleWord;
-    bonus_board[14][0] = Bonus::TripleWord;
-    bonus_board[14][7] = Bonus::TripleWord;
-    bonus_board[14][14] = Bonus::TripleWord;
-    
-    // Double Word Score positions
-    bonus_board[1][1] = Bonus::DoubleWord;
-    bonus_board[2][2] = Bonus::DoubleWord;
-    bonus_board[3][3] = Bonus::DoubleWord;
-    bonus_board[4][4] = Bonus::DoubleWord;
-    bonus_board[10][10] = Bonus::DoubleWord;
-    bonus_board[11][11] = Bonus::DoubleWord;
-    bonus_board[12][12] = Bonus::DoubleWord;
-    bonus_board[13][13] = Bonus::DoubleWord;
-    
-    bonus_board[1][13] = Bonus::DoubleWord;
-    bonus_board[2][12] = Bonus::DoubleWord;
-    bonus_board[3][11] = Bonus::DoubleWord;
-    bonus_board[4][10] = Bonus::DoubleWord;
-    bonus_board[10][4] = Bonus::DoubleWord;
-    bonus_board[11][3] = Bonus::DoubleWord;
-    bonus_board[12][2] = Bonus::DoubleWord;
-    bonus_board[13][1] = Bonus::DoubleWord;
-    
-    // Triple Letter Score positions
-    bonus_board[1][5] = Bonus::TripleLetter;
-    bonus_board[1][9] = Bonus::TripleLetter;
-    bonus_board[5][1] = Bonus::TripleLetter;
-    bonus_board[5][5] = Bonus::TripleLetter;
-    bonus_board[5][9] = Bonus::TripleLetter;
-    bonus_board[5][13] = Bonus::TripleLetter;
-    bonus_board[9][1] = Bonus::TripleLetter;
-    bonus_board[9][5] = Bonus::TripleLetter;
-    bonus_board[9][9] = Bonus::TripleLetter;
-    bonus_board[9][13] = Bonus::TripleLetter;
-    bonus_board[13][5] = Bonus::TripleLetter;
-    bonus_board[13][9] = Bonus::TripleLetter;
-    
-    // Double Letter Score positions
-    bonus_board[0][3] = Bonus::DoubleLetter;
-    bonus_board[0][11] = Bonus::DoubleLetter;
-    bonus_board[2][6] = Bonus::DoubleLetter;
-    bonus_board[2][8] = Bonus::DoubleLetter;
-    bonus_board[3][0] = Bonus::DoubleLetter;
-    bonus_board[3][7] = Bonus::DoubleLetter;
-    bonus_board[3][14] = Bonus::DoubleLetter;
-    bonus_board[6][2] = Bonus::DoubleLetter;
-    bonus_board[6][6] = Bonus::DoubleLetter;
-    bonus_board[6][8] = Bonus::DoubleLetter;
-    bonus_board[6][12] = Bonus::DoubleLetter;
-    bonus_board[7][3] = Bonus::DoubleLetter;
-    bonus_board[7][11] = Bonus::DoubleLetter;
-    bonus_board[8][2] = Bonus::DoubleLetter;
-    bonus_board[8][6] = Bonus::DoubleLetter;
-    bonus_board[8][8] = Bonus::DoubleLetter;
-    bonus_board[8][12] = Bonus::DoubleLetter;
-    bonus_board[11][0] = Bonus::DoubleLetter;
-    bonus_board[11][7] = Bonus::DoubleLetter;
-    bonus_board[11][14] = Bonus::DoubleLetter;
-    bonus_board[12][6] = Bonus::DoubleLetter;
-    bonus_board[12][8] = Bonus::DoubleLetter;
-    bonus_board[14][3] = Bonus::DoubleLetter;
-    bonus_board[14][11] = Bonus::DoubleLetter;
 }
 
 /**
  * Get the bonus type at a specific position
  */
-Bonus Board::getBonus(int row, int col) const {
-    if (row < 0 || row >= 15 || col < 0 || col >= 15) {
+template <int N>
+Bonus BasicBoard<N>::getBonus(int row, int col) const {
+    if (row < 0 || row >= N || col < 0 || col >= N) {
         return Bonus::None;
     }
     return bonus_board[row][col];
@@ -96,8 +92,9 @@ Bonus Board::getBonus(int row, int col) const {
 /**
  * Get the tile at a specific position
  */
-Tile Board::getTile(int row, int col) const {
-    if (row < 0 || row >= 15 || col < 0 || col >= 15) {
+template <int N>
+Tile BasicBoard<N>::getTile(int row, int col) const {
+    if (row < 0 || row >= N || col < 0 || col >= N) {
         return Tile(); // Return empty tile for invalid positions
     }
     return tile_board[row][col];
@@ -106,8 +103,9 @@ Tile Board::getTile(int row, int col) const {
 /**
  * Set a tile at a specific position
  */
-void Board::setTile(int row, int col, const Tile& tile) {
-    if (row >= 0 && row < 15 && col >= 0 && col < 15) {
+template <int N>
+void BasicBoard<N>::setTile(int row, int col, const Tile& tile) {
+    if (row >= 0 && row < N && col >= 0 && col < N) {
         tile_board[row][col] = tile;
     }
 }
@@ -115,9 +113,28 @@ void Board::setTile(int row, int col, const Tile& tile) {
 /**
  * Check if a position is empty
  */
-bool Board::isEmpty(int row, int col) const {
-    if (row < 0 || row >= 15 || col < 0 || col >= 15) {
+template <int N>
+bool BasicBoard<N>::isEmpty(int row, int col) const {
+    if (row < 0 || row >= N || col < 0 || col >= N) {
         return false; // Invalid positions are considered not empty
     }
     return tile_board[row][col].isEmpty();
-}
\ No newline at end of file
+}
+
+/**
+ * Build a copy of the board with rows and columns swapped
+ */
+template <int N>
+BasicBoard<N> BasicBoard<N>::transposed() const {
+    BasicBoard result;
+    for (int row = 0; row < N; row++) {
+        for (int col = 0; col < N; col++) {
+            result.tile_board[col][row] = tile_board[row][col];
+        }
+    }
+    return result;
+}
+
+// Supported board sizes
+template class BasicBoard<15>;
+template class BasicBoard<21>;
@@ -11,7 +11,9 @@ enum class Bonus {
     DoubleLetter = 1,
     TripleLetter = 2,
     DoubleWord = 3,
-    TripleWord = 4
+    TripleWord = 4,
+    QuadrupleLetter = 5,    // Only on the 21x21 board
+    QuadrupleWord = 6
 };
 
 /**
@@ -51,53 +53,96 @@ struct Move {
 };
 
 /**
- * Represents the Scrabble game board
+ * Premium square layout of an N x N board, one string per row:
+ * 'Q', 'T', 'D' for word multipliers, 'q', 't', 'd' for letter multipliers,
+ * '.' for plain squares. Specialised for each supported size in engine.cpp
+ * (15: standard board, 21: Super board). Layouts are symmetric about the diagonal.
  */
-class Board {
+template <int N>
+struct BoardLayout {
+    static const char* const ROWS[N];
+};
+
+template <> const char* const BoardLayout<15>::ROWS[15];
+template <> const char* const BoardLayout<21>::ROWS[21];
+
+/**
+ * Represents the Scrabble game board.
+ * The size is a template parameter so that every loop over the board has
+ * constant bounds; engine.cpp instantiates the supported sizes.
+ */
+template <int N>
+class BasicBoard {
+public:
+    static const int SIZE = N;
+    static const int SQUARES = N * N;
+    static const int CENTER = N / 2;    // Square the first move must cover (CENTER, CENTER)
+
 private:
     // Static bonus board (read-only after initialization)
-    Bonus bonus_board[15][15];
+    Bonus bonus_board[N][N];
     
     // Dynamic tile board (modified during gameplay)
-    Tile tile_board[15][15];
+    Tile tile_board[N][N];
 
 public:
     /**
-     * Constructor - initializes the board with standard Scrabble layout
+     * Constructor - initializes the board with the layout of its size (BoardLayout<N>)
      */
-    Board();
+    BasicBoard();
     
     /**
      * Get the bonus type at a specific position
-     * @param row Row index (0-14)
-     * @param col Column index (0-14)
+     * @param row Row index (0 to N-1)
+     * @param col Column index (0 to N-1)
      * @return Bonus type at the position
      */
     Bonus getBonus(int row, int col) const;
     
     /**
      * Get the tile at a specific position
-     * @param row Row index (0-14)
-     * @param col Column index (0-14)
+     * @param row Row index (0 to N-1)
+     * @param col Column index (0 to N-1)
      * @return Tile at the position
      */
     Tile getTile(int row, int col) const;
     
     /**
      * Set a tile at a specific position
-     * @param row Row index (0-14)
-     * @param col Column index (0-14)
+     * @param row Row index (0 to N-1)
+     * @param col Column index (0 to N-1)
      * @param tile Tile to place
      */
     void setTile(int row, int col, const Tile& tile);
     
     /**
      * Check if a position is empty
-     * @param row Row index (0-14)
-     * @param col Column index (0-14)
+     * @param row Row index (0 to N-1)
+     * @param col Column index (0 to N-1)
      * @return true if position is empty
      */
     bool isEmpty(int row, int col) const;
+    
+    /**
+     * Build a copy of the board with rows and columns swapped.
+     * The bonus layout is symmetric, so only tiles move.
+     * Used to generate vertical moves with the horizontal generator.
+     * @return Transposed board
+     */
+    BasicBoard transposed() const;
+    
+    /**
+     * Direct read access to the tile grid, row-major (row * N + col).
+     * For bulk consumers (encoders) that would otherwise call getTile per square.
+     * @return Pointer to the N * N tiles
+     */
+    const Tile* tileData() const { return &tile_board[0][0]; }
 };
 
+// The standard 15x15 board, used by everything that does not name a size
+using Board = BasicBoard<15>;
+
+// The 21x21 board of the Super variant
+using SuperBoard = BasicBoard<21>;
+
 #endif /* ENGINE_H */
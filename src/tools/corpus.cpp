@@ -0,0 +1,83 @@
+#include "../engine/Gaddag.h"
+#include "../engine/Corpus.h"
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <cstdlib>
+#include <chrono>
+#include <thread>
+
+using namespace Scrabble;
+
+void printUsage(const char* prog) {
+    std::cerr << "Usage: " << prog << " [options]\n"
+              << "  --count N        Number of positions (default 1000)\n"
+              << "  --seed N         Base RNG seed (default 1)\n"
+              << "  --threads N      Worker threads (default: hardware concurrency)\n"
+              << "  --classes LIST   Comma-separated: opening,midgame,lategame,blanks,cramped (default all)\n"
+              << "  --out PATH       Text corpus, \"<board> | <rack>\" per line\n"
+              << "  --out-bin PATH   Binary corpus (see src/engine/Corpus.h)\n"
+              << "  --dict PATH      Word list (default assets/dictionnaries/french.txt)\n"
+              << "  --bin PATH       Binary GADDAG cache (default assets/dictionnaries/french.bin)\n";
+}
+
+int main(int argc, char** argv) {
+    CorpusConfig config;
+    config.threads = (int)std::thread::hardware_concurrency();
+    std::string textPath;
+    std::string binaryPath;
+    std::string dictPath = "assets/dictionnaries/french.txt";
+    std::string binPath = "assets/dictionnaries/french.bin";
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (i + 1 >= argc) {
+            printUsage(argv[0]);
+            return 1;
+        }
+        std::string value = argv[++i];
+        if (arg == "--count") config.count = (size_t)std::atol(value.c_str());
+        else if (arg == "--seed") config.seed = std::strtoull(value.c_str(), nullptr, 10);
+        else if (arg == "--threads") config.threads = std::atoi(value.c_str());
+        else if (arg == "--out") textPath = value;
+        else if (arg == "--out-bin") binaryPath = value;
+        else if (arg == "--dict") dictPath = value;
+        else if (arg == "--bin") binPath = value;
+        else if (arg == "--classes") {
+            std::stringstream ss(value);
+            std::string name;
+            while (std::getline(ss, name, ',')) {
+                PositionClass positionClass;
+                if (!positionClassByName(name, positionClass)) {
+                    std::cerr << "Unknown class: " << name << std::endl;
+                    return 1;
+                }
+                config.classes.push_back(positionClass);
+            }
+        } else {
+            printUsage(argv[0]);
+            return 1;
+        }
+    }
+    if (textPath.empty() && binaryPath.empty()) {
+        printUsage(argv[0]);
+        return 1;
+    }
+
+    Gaddag gaddag;
+    if (!gaddag.loadCached(dictPath, binPath)) {
+        std::cerr << "Failed to load dictionary: " << dictPath << std::endl;
+        return 1;
+    }
+
+    auto tStart = std::chrono::high_resolution_clock::now();
+    std::vector<CorpusPosition> positions = generateCorpus(gaddag, config);
+    auto tEnd = std::chrono::high_resolution_clock::now();
+    std::cout << "Generated " << positions.size() << " positions in "
+              << std::chrono::duration_cast<std::chrono::milliseconds>(tEnd - tStart).count()
+              << " ms." << std::endl;
+
+    if (!textPath.empty() && !writeCorpusText(textPath, positions)) return 1;
+    if (!binaryPath.empty() && !writeCorpusBinary(binaryPath, positions)) return 1;
+    return 0;
+}
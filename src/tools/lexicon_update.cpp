@@ -0,0 +1,101 @@
+#include "../engine/Gaddag.h"
+#include "../engine/LexiconUpdate.h"
+#include "../engine/LazyGaddag.h"
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <chrono>
+
+using namespace Scrabble;
+
+void printUsage(const char* prog) {
+    std::cerr << "Usage: " << prog << " --delta PATH --out PATH [options]\n"
+              << "  --delta PATH     Word changes, one per line: +WORD adds, -WORD removes (# comments)\n"
+              << "  --out PATH       Updated binary GADDAG\n"
+              << "  --paged PATH     Also write the paged form (see src/engine/LazyGaddag.h)\n"
+              << "  --words-out PATH Also write the updated word list\n"
+              << "  --verify         Rebuild from the updated word list and compare\n"
+              << "  --dict PATH      Word list of the current GADDAG (default assets/dictionnaries/french.txt)\n"
+              << "  --bin PATH       GADDAG to update (default assets/dictionnaries/french.bin)\n";
+}
+
+static double msSince(std::chrono::high_resolution_clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+}
+
+int main(int argc, char** argv) {
+    std::string deltaPath, outPath, pagedPath, wordsOutPath;
+    std::string dictPath = "assets/dictionnaries/french.txt";
+    std::string binPath = "assets/dictionnaries/french.bin";
+    bool verify = false;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--verify") {
+            verify = true;
+            continue;
+        }
+        if (i + 1 >= argc) {
+            printUsage(argv[0]);
+            return 1;
+        }
+        std::string value = argv[++i];
+        if (arg == "--delta") deltaPath = value;
+        else if (arg == "--out") outPath = value;
+        else if (arg == "--paged") pagedPath = value;
+        else if (arg == "--words-out") wordsOutPath = value;
+        else if (arg == "--dict") dictPath = value;
+        else if (arg == "--bin") binPath = value;
+        else {
+            printUsage(argv[0]);
+            return 1;
+        }
+    }
+    if (deltaPath.empty() || outPath.empty()) {
+        printUsage(argv[0]);
+        return 1;
+    }
+
+    LexiconDelta delta;
+    if (!loadDelta(deltaPath, delta)) return 1;
+
+    auto tStart = std::chrono::high_resolution_clock::now();
+    Gaddag gaddag;
+    if (!gaddag.loadCached(dictPath, binPath)) {
+        std::cerr << "Failed to load dictionary: " << dictPath << std::endl;
+        return 1;
+    }
+    std::cout << "Loaded in " << msSince(tStart) << " ms." << std::endl;
+
+    tStart = std::chrono::high_resolution_clock::now();
+    DeltaStats stats = applyDelta(gaddag, delta);
+    std::cout << "Applied " << delta.size() << " edits in " << msSince(tStart) << " ms: " << stats.added
+              << " added, " << stats.removed << " removed, " << stats.alreadyPresent << " already present, "
+              << stats.notFound << " not found." << std::endl;
+
+    if (!gaddag.saveBinary(outPath)) return 1;
+    if (!pagedPath.empty() && !LazyGaddag::savePaged(gaddag, pagedPath)) return 1;
+
+    if (verify || !wordsOutPath.empty()) {
+        std::vector<std::string> words;
+        if (!loadWordList(dictPath, words)) return 1;
+        if (!wordsOutPath.empty()) {
+            std::ofstream out(wordsOutPath);
+            for (const std::string& word : applyDelta(words, delta)) out << word << "\n";
+            if (!out.good()) {
+                std::cerr << "Error writing word list: " << wordsOutPath << std::endl;
+                return 1;
+            }
+        }
+        if (verify) {
+            tStart = std::chrono::high_resolution_clock::now();
+            std::string difference;
+            if (!verifyDelta(words, delta, gaddag, &difference)) {
+                std::cerr << "Verification failed: graphs differ at path \"" << difference << "\"" << std::endl;
+                return 1;
+            }
+            std::cout << "Verified against a full rebuild (" << msSince(tStart) << " ms)." << std::endl;
+        }
+    }
+    return 0;
+}
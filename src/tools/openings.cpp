@@ -0,0 +1,80 @@
+#include "../engine/Gaddag.h"
+#include "../engine/Openings.h"
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <cstdlib>
+#include <chrono>
+#include <thread>
+
+using namespace Scrabble;
+
+void printUsage(const char* prog) {
+    std::cerr << "Usage: " << prog << " --out PATH [options]\n"
+              << "  --out PATH       Opening table to write (see src/engine/Openings.h)\n"
+              << "  --moves N        Best moves kept per rack (default 4)\n"
+              << "  --threads N      Worker threads (default: hardware concurrency)\n"
+              << "  --max-blanks N   Skip racks with more blanks (default 2)\n"
+              << "  --racks PATH     Only the racks listed in a file, one per line (default all)\n"
+              << "  --dict PATH      Word list (default assets/dictionnaries/french.txt)\n"
+              << "  --bin PATH       Binary GADDAG cache (default assets/dictionnaries/french.bin)\n";
+}
+
+int main(int argc, char** argv) {
+    OpeningBuildConfig config;
+    config.threads = (int)std::thread::hardware_concurrency();
+    std::string outPath;
+    std::string dictPath = "assets/dictionnaries/french.txt";
+    std::string binPath = "assets/dictionnaries/french.bin";
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (i + 1 >= argc) {
+            printUsage(argv[0]);
+            return 1;
+        }
+        std::string value = argv[++i];
+        if (arg == "--out") outPath = value;
+        else if (arg == "--moves") config.movesPerRack = std::atoi(value.c_str());
+        else if (arg == "--threads") config.threads = std::atoi(value.c_str());
+        else if (arg == "--max-blanks") config.maxBlanks = std::atoi(value.c_str());
+        else if (arg == "--racks") {
+            std::ifstream in(value);
+            if (!in.is_open()) {
+                std::cerr << "Error opening rack list: " << value << std::endl;
+                return 1;
+            }
+            std::string line;
+            while (std::getline(in, line)) {
+                if (!line.empty()) config.racks.push_back(line);
+            }
+        }
+        else if (arg == "--dict") dictPath = value;
+        else if (arg == "--bin") binPath = value;
+        else {
+            printUsage(argv[0]);
+            return 1;
+        }
+    }
+    if (outPath.empty()) {
+        printUsage(argv[0]);
+        return 1;
+    }
+
+    Gaddag gaddag;
+    if (!gaddag.loadCached(dictPath, binPath)) {
+        std::cerr << "Failed to load dictionary: " << dictPath << std::endl;
+        return 1;
+    }
+
+    auto tStart = std::chrono::high_resolution_clock::now();
+    bool ok = buildOpeningTable(gaddag, outPath, config, [](size_t done, size_t total) {
+        std::cout << "\r" << done << " / " << total << " racks" << std::flush;
+    });
+    auto tEnd = std::chrono::high_resolution_clock::now();
+    std::cout << std::endl;
+    if (!ok) return 1;
+    std::cout << "Wrote " << outPath << " in "
+              << std::chrono::duration_cast<std::chrono::seconds>(tEnd - tStart).count() << " s." << std::endl;
+    return 0;
+}
@@ -0,0 +1,124 @@
+#include "../engine/Gaddag.h"
+#include "../engine/SelfPlay.h"
+#include "../engine/TrainingData.h"
+#include "../engine/Openings.h"
+#include <iostream>
+#include <string>
+#include <cstdlib>
+#include <chrono>
+#include <thread>
+
+using namespace Scrabble;
+
+void printUsage(const char* prog) {
+    std::cerr << "Usage: " << prog << " [options]\n"
+              << "  --games N        Number of games to play (default 1000)\n"
+              << "  --threads N      Worker threads (default: hardware concurrency)\n"
+              << "  --seed N         Base RNG seed (default 1)\n"
+              << "  --policy NAME    Policy for both players: greedy | random (default greedy)\n"
+              << "  --p1 NAME        Policy for player 1 (overrides --policy)\n"
+              << "  --p2 NAME        Policy for player 2 (overrides --policy)\n"
+              << "  --out PATH       Write positions and candidate moves as columnar training data\n"
+              << "  --candidates N   Keep only the N best candidates per turn in --out (default all)\n"
+              << "  --openings PATH  Serve first moves from an opening table (see the openings tool)\n"
+              << "  --dict PATH      Word list (default assets/dictionnaries/french.txt)\n"
+              << "  --bin PATH       Binary GADDAG cache (default assets/dictionnaries/french.bin)\n";
+}
+
+int main(int argc, char** argv) {
+    SelfPlayConfig config;
+    config.games = 1000;
+    config.threads = (int)std::thread::hardware_concurrency();
+    std::string policyNames[Game::NUM_PLAYERS] = {"greedy", "greedy"};
+    std::string dictPath = "assets/dictionnaries/french.txt";
+    std::string binPath = "assets/dictionnaries/french.bin";
+    std::string outPath;
+    std::string openingsPath;
+    size_t candidateLimit = 0;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (i + 1 >= argc) {
+            printUsage(argv[0]);
+            return 1;
+        }
+        std::string value = argv[++i];
+        if (arg == "--games") config.games = std::atoi(value.c_str());
+        else if (arg == "--threads") config.threads = std::atoi(value.c_str());
+        else if (arg == "--seed") config.seed = std::strtoull(value.c_str(), nullptr, 10);
+        else if (arg == "--policy") policyNames[0] = policyNames[1] = value;
+        else if (arg == "--p1") policyNames[0] = value;
+        else if (arg == "--p2") policyNames[1] = value;
+        else if (arg == "--out") outPath = value;
+        else if (arg == "--candidates") candidateLimit = (size_t)std::atol(value.c_str());
+        else if (arg == "--openings") openingsPath = value;
+        else if (arg == "--dict") dictPath = value;
+        else if (arg == "--bin") binPath = value;
+        else {
+            printUsage(argv[0]);
+            return 1;
+        }
+    }
+
+    for (int p = 0; p < Game::NUM_PLAYERS; ++p) {
+        config.policies[p] = policyByName(policyNames[p]);
+        if (!config.policies[p]) {
+            std::cerr << "Unknown policy: " << policyNames[p] << std::endl;
+            return 1;
+        }
+    }
+    if (config.threads <= 0) config.threads = 1;
+
+    std::cout << "=== Scrabble Self-Play ===" << std::endl;
+
+    Gaddag gaddag;
+    auto tStart = std::chrono::high_resolution_clock::now();
+    if (!gaddag.loadCached(dictPath, binPath)) {
+        std::cerr << "Failed to load dictionary: " << dictPath << std::endl;
+        return 1;
+    }
+    auto tEnd = std::chrono::high_resolution_clock::now();
+    std::cout << "Dictionary loaded in "
+              << std::chrono::duration_cast<std::chrono::milliseconds>(tEnd - tStart).count()
+              << " ms." << std::endl;
+
+    OpeningTable openings;
+    if (!openingsPath.empty()) {
+        if (!openings.open(openingsPath, gaddag)) return 1;
+        config.openings = &openings;
+    }
+
+    std::cout << "Playing " << config.games << " games on " << config.threads << " threads ("
+              << policyNames[0] << " vs " << policyNames[1] << ")..." << std::endl;
+
+    TrainingWriter writer;
+    if (!outPath.empty()) {
+        if (!writer.open(outPath)) return 1;
+        config.observer = [&writer, candidateLimit]() {
+            return std::unique_ptr<GameObserver>(new TrainingRecorder(writer, candidateLimit));
+        };
+    }
+
+    SelfPlayStats stats = runSelfPlay(gaddag, config);
+
+    if (!outPath.empty()) {
+        if (!writer.close()) {
+            std::cerr << "Failed to write training data: " << outPath << std::endl;
+            return 1;
+        }
+        std::cout << "Wrote " << writer.positionsWritten() << " positions and "
+                  << writer.movesWritten() << " moves to " << outPath << std::endl;
+    }
+
+    std::cout << std::string(40, '-') << std::endl;
+    std::cout << "Games:            " << stats.games << std::endl;
+    std::cout << "Turns:            " << stats.turns << " (" << stats.plays << " placements)" << std::endl;
+    std::cout << "Candidates:       " << stats.candidates << std::endl;
+    std::cout << "Avg Final Score:  "
+              << (stats.games ? (double)stats.totalScore / (stats.games * Game::NUM_PLAYERS) : 0) << std::endl;
+    std::cout << "Elapsed:          " << stats.seconds << " s" << std::endl;
+    std::cout << "Games/s:          " << stats.gamesPerSecond() << std::endl;
+    std::cout << "Moves/s:          " << stats.movesPerSecond() << std::endl;
+
+    return 0;
+}
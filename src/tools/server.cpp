@@ -0,0 +1,119 @@
+#include "../engine/Gaddag.h"
+#include "../engine/LazyGaddag.h"
+#include "../engine/Server.h"
+#include <iostream>
+#include <string>
+#include <fstream>
+#include <memory>
+#include <cstdlib>
+#include <chrono>
+#include <thread>
+#include <csignal>
+#include <unistd.h>
+
+using namespace Scrabble;
+
+static SolverServer* activeServer = nullptr;
+
+static void onTerminate(int) {
+    // Only closes the listening socket (async-signal-safe)
+    if (activeServer) activeServer->stopListening();
+}
+
+void printUsage(const char* prog) {
+    std::cerr << "Usage: " << prog << " [options]\n"
+              << "  --threads N      Worker threads (default: hardware concurrency)\n"
+              << "  --socket PATH    Serve on a Unix domain socket instead of stdin/stdout\n"
+              << "  --stdio          Also serve stdin/stdout when --socket is given\n"
+              << "  --dict PATH      Word list (default assets/dictionnaries/french.txt)\n"
+              << "  --bin PATH       Binary GADDAG cache (default assets/dictionnaries/french.bin)\n"
+              << "  --lazy PATH      Paged GADDAG: answer at once, load the rest in the background\n"
+              << "                   (written from --dict/--bin if missing)\n"
+              << "Protocol: one request per line, see src/engine/Server.h.\n";
+}
+
+int main(int argc, char** argv) {
+    int threads = (int)std::thread::hardware_concurrency();
+    std::string socketPath;
+    bool stdio = false;
+    std::string dictPath = "assets/dictionnaries/french.txt";
+    std::string binPath = "assets/dictionnaries/french.bin";
+    std::string lazyPath;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--stdio") {
+            stdio = true;
+            continue;
+        }
+        if (i + 1 >= argc) {
+            printUsage(argv[0]);
+            return 1;
+        }
+        std::string value = argv[++i];
+        if (arg == "--threads") threads = std::atoi(value.c_str());
+        else if (arg == "--socket") socketPath = value;
+        else if (arg == "--dict") dictPath = value;
+        else if (arg == "--bin") binPath = value;
+        else if (arg == "--lazy") lazyPath = value;
+        else {
+            printUsage(argv[0]);
+            return 1;
+        }
+    }
+    if (threads <= 0) threads = 1;
+    if (socketPath.empty()) stdio = true;
+
+    // stdout carries responses: keep every log line on stderr
+    std::cout.rdbuf(std::cerr.rdbuf());
+    // A client hanging up must not kill the server
+    std::signal(SIGPIPE, SIG_IGN);
+
+    Gaddag gaddag;
+    LazyGaddag lexicon;
+    auto tStart = std::chrono::high_resolution_clock::now();
+    if (!lazyPath.empty()) {
+        std::ifstream paged(lazyPath);
+        if (!paged.good()) {
+            // First run: build the paged file once
+            Gaddag source;
+            if (!source.loadCached(dictPath, binPath) || !LazyGaddag::savePaged(source, lazyPath)) {
+                std::cerr << "Failed to write paged dictionary: " << lazyPath << std::endl;
+                return 1;
+            }
+        }
+        if (!lexicon.open(lazyPath)) {
+            std::cerr << "Failed to open paged dictionary: " << lazyPath << std::endl;
+            return 1;
+        }
+    } else if (!gaddag.loadCached(dictPath, binPath)) {
+        std::cerr << "Failed to load dictionary: " << dictPath << std::endl;
+        return 1;
+    }
+    auto tEnd = std::chrono::high_resolution_clock::now();
+    std::cerr << "Dictionary " << (lazyPath.empty() ? "loaded" : "opened (loading in the background)") << " in "
+              << std::chrono::duration_cast<std::chrono::milliseconds>(tEnd - tStart).count()
+              << " ms. Serving on " << threads << " threads." << std::endl;
+
+    std::unique_ptr<SolverServer> owned(lazyPath.empty() ? new SolverServer(gaddag, threads)
+                                                         : new SolverServer(lexicon, threads));
+    SolverServer& server = *owned;
+
+    if (socketPath.empty()) {
+        server.serve(STDIN_FILENO, STDOUT_FILENO);
+        return 0;
+    }
+
+    if (stdio) {
+        // The socket keeps serving after stdin closes; SIGINT/SIGTERM stop it
+        std::thread([&server]() { server.serve(STDIN_FILENO, STDOUT_FILENO); }).detach();
+    }
+    activeServer = &server;
+    std::signal(SIGINT, onTerminate);
+    std::signal(SIGTERM, onTerminate);
+
+    std::cerr << "Listening on " << socketPath << std::endl;
+    bool ok = server.listenUnix(socketPath);
+    // The console thread may still be blocked on stdin: leave without unwinding the server
+    std::_Exit(ok ? 0 : 1);
+}
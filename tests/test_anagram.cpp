@@ -0,0 +1,105 @@
+#include "Anagram.h"
+#include "test_support.h"
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <cassert>
+#include <cctype>
+
+using namespace Scrabble;
+
+static const char* WORDS[] = {"CHAT", "CHATS", "ACHAT", "AS", "TA", "AH", "HA", "TE", "ET", "ES", "SE", "LA", "LE",
+                              "ILE", "SEL", "TES", "RAT", "RATS", "ARTS", "STAR", "TSAR", "MER", "MERE", "SALE",
+                              "TALE", "SEAU", "ETALES"};
+
+// Reference: every word whose letters the rack can cover, blanks filling the gaps
+static std::vector<std::string> bruteForce(const std::string& rack, bool exact) {
+    std::vector<std::string> out;
+    for (const char* w : WORDS) {
+        std::string word = w;
+        int counts[26] = {};
+        int blanks = 0, tiles = 0;
+        for (char c : rack) {
+            if (c == '?') blanks++;
+            else counts[c - 'A']++;
+            tiles++;
+        }
+        for (char c : word) {
+            if (counts[c - 'A'] > 0) counts[c - 'A']--;
+            else blanks--;
+        }
+        if (blanks >= 0 && (!exact || (int)word.length() == tiles)) out.push_back(word);
+    }
+    std::sort(out.begin(), out.end());
+    return out;
+}
+
+static std::vector<std::string> upperWords(const std::vector<AnagramMatch>& matches) {
+    std::vector<std::string> out;
+    for (const AnagramMatch& m : matches) {
+        std::string w = m.word;
+        std::transform(w.begin(), w.end(), w.begin(), ::toupper);
+        out.push_back(w);
+    }
+    std::sort(out.begin(), out.end());
+    return out;
+}
+
+int main() {
+    std::cout << "Starting Anagram Test..." << std::endl;
+
+    Gaddag gaddag;
+    bool loaded = loadWords(gaddag, "test_anagram_words.txt", WORDS);
+    assert(loaded);
+    (void)loaded;
+
+    std::cout << "Testing exact anagrams... ";
+    AnagramQuery exact;
+    exact.exact = true;
+    std::vector<AnagramMatch> star = findAnagrams(gaddag, "RTSA", exact);
+    assert(upperWords(star) == std::vector<std::string>({"ARTS", "RATS", "STAR", "TSAR"}));
+    assert(star[0].word == "ARTS" && star[0].blanksUsed == 0);
+    assert(findAnagrams(gaddag, "xyz", exact).empty());
+    std::cout << "OK" << std::endl;
+
+    std::cout << "Testing sub-anagrams... ";
+    std::vector<AnagramMatch> sub = findAnagrams(gaddag, "chats");
+    assert(upperWords(sub) == bruteForce("CHATS", false));
+    // Longest first
+    assert(sub[0].word == "CHATS");
+    AnagramQuery longOnly;
+    longOnly.minLength = 4;
+    for (const AnagramMatch& m : findAnagrams(gaddag, "CHATS", longOnly)) assert(m.word.length() >= 4);
+    std::cout << "OK" << std::endl;
+
+    std::cout << "Testing blanks... ";
+    std::vector<AnagramMatch> blank = findAnagrams(gaddag, "CHA?", exact);
+    assert(blank.size() == 1 && blank[0].word == "CHAt" && blank[0].blanksUsed == 1);
+    for (const char* rack : {"ST?", "AE??", "SALE?", "?", "RATS?"}) {
+        std::string upper(rack);
+        assert(upperWords(findAnagrams(gaddag, rack)) == bruteForce(upper, false));
+        assert(upperWords(findAnagrams(gaddag, rack, exact)) == bruteForce(upper, true));
+    }
+    // A real tile is preferred to the blank
+    for (const AnagramMatch& m : findAnagrams(gaddag, "SALE*")) {
+        if (m.word == "SALE") assert(m.blanksUsed == 0);
+    }
+    std::cout << "OK" << std::endl;
+
+    std::cout << "Testing limit and batch... ";
+    AnagramQuery limited;
+    limited.limit = 3;
+    assert(findAnagrams(gaddag, "ETALES??", limited).size() == 3);
+    std::vector<std::string> racks = {"CHATS", "RTSA", "SALE?", "", "ETALES"};
+    std::vector<std::vector<AnagramMatch>> batch = findAnagramsBatch(gaddag, racks, AnagramQuery(), 3);
+    assert(batch.size() == racks.size() && batch[3].empty());
+    for (size_t i = 0; i < racks.size(); ++i) {
+        assert(upperWords(batch[i]) == upperWords(findAnagrams(gaddag, racks[i])));
+    }
+    std::cout << "OK" << std::endl;
+
+    std::cout << "All Anagram Tests Passed!" << std::endl;
+    return 0;
+}
@@ -0,0 +1,127 @@
+/* Compiled as C to check that the public header is valid C and the ABI links without C++. */
+#include "scrabble_c.h"
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static const char* WORDS = "CHAT\nCHATS\nTA\nAS\nSA\nTAS\nHA\nAH\n";
+
+static void emptyBoard(char* board) {
+    memset(board, '.', SC_BOARD_CHARS);
+    board[SC_BOARD_CHARS] = '\0';
+}
+
+int main(void) {
+    const char* path = "test_capi_words.txt";
+    FILE* f;
+    sc_lexicon* lexicon;
+    sc_generator* generator;
+    sc_position* positions[2];
+    char board[SC_BOARD_CHARS + 1];
+    char roundTrip[SC_BOARD_CHARS + 1];
+    sc_move moves[256];
+    size_t count = 0;
+    size_t offsets[3];
+    char boards[2 * SC_BOARD_CHARS];
+    char racks[2 * SC_RACK_STRIDE];
+    int32_t scores[2];
+    sc_move best[2];
+    float* planes;
+    size_t i;
+    int found;
+    sc_status status;
+
+    printf("Starting C ABI Test...\n");
+    assert(sc_abi_version() == SC_ABI_VERSION);
+
+    f = fopen(path, "w");
+    assert(f != NULL);
+    fputs(WORDS, f);
+    fclose(f);
+    lexicon = sc_lexicon_load(path, NULL);
+    remove(path);
+    assert(lexicon != NULL);
+    assert(sc_lexicon_contains(lexicon, "CHATS") == 1);
+    assert(sc_lexicon_contains(lexicon, "CHATTE") == 0);
+
+    generator = sc_generator_new(lexicon);
+    positions[0] = sc_position_new();
+    positions[1] = sc_position_new();
+    assert(generator && positions[0] && positions[1]);
+
+    /* Opening position: CHAT must be playable through the centre */
+    emptyBoard(board);
+    status = sc_position_set_board(positions[0], board);
+    assert(status == SC_OK);
+    status = sc_position_set_rack(positions[0], "CHATSXZ");
+    assert(status == SC_OK);
+    status = sc_generate(generator, positions[0], moves, 256, &count);
+    assert(status == SC_OK && count > 0);
+    found = 0;
+    for (i = 0; i < count; ++i) {
+        if (strcmp(moves[i].word, "CHATS") == 0 && moves[i].horizontal) found = 1;
+    }
+    assert(found);
+
+    /* Too small an output array reports the size needed */
+    status = sc_generate(generator, positions[0], moves, 1, &count);
+    assert(status == SC_ERR_CAPACITY && count > 1);
+    assert(strlen(sc_last_error()) > 0);
+
+    /* Play the first move, then check the board round-trips */
+    status = sc_generate(generator, positions[0], moves, 256, &count);
+    assert(status == SC_OK);
+    status = sc_position_apply(positions[0], &moves[0]);
+    assert(status == SC_OK);
+    status = sc_position_get_board(positions[0], roundTrip);
+    assert(status == SC_OK && strcmp(roundTrip, board) != 0);
+
+    /* Batched generation over handles and over raw strings agree */
+    status = sc_position_set_board(positions[1], roundTrip);
+    assert(status == SC_OK);
+    status = sc_position_set_rack(positions[1], "S?");
+    assert(status == SC_OK);
+    status = sc_position_set_rack(positions[0], "AS");
+    assert(status == SC_OK);
+    status = sc_generate_batch(generator, (const sc_position* const*)positions, 2, moves, 256, offsets);
+    assert(status == SC_OK);
+    assert(offsets[0] == 0 && offsets[2] >= offsets[1]);
+
+    memcpy(boards, roundTrip, SC_BOARD_CHARS);
+    memcpy(boards + SC_BOARD_CHARS, roundTrip, SC_BOARD_CHARS);
+    memset(racks, 0, sizeof(racks));
+    memcpy(racks, "AS", 2);
+    memcpy(racks + SC_RACK_STRIDE, "S?", 2);
+    {
+        size_t stringOffsets[3];
+        status = sc_generate_batch_strings(generator, boards, racks, 2, moves, 256, stringOffsets);
+        assert(status == SC_OK);
+        assert(stringOffsets[2] == offsets[2]);
+    }
+
+    status = sc_best_moves(generator, (const sc_position* const*)positions, 2, scores, best);
+    assert(status == SC_OK);
+    assert(scores[1] == best[1].score);
+
+    /* Tensor encoding fills caller-owned buffers */
+    planes = (float*)calloc(2 * sc_encoder_sample_size(), sizeof(float));
+    assert(planes != NULL);
+    status = sc_encode_positions(generator, (const sc_position* const*)positions, 2, planes);
+    assert(status == SC_OK);
+    if (scores[1] > 0) {
+        status = sc_encode_moves(generator, positions[1], &best[1], 1, planes);
+        assert(status == SC_OK);
+    }
+    free(planes);
+
+    sc_position_free(positions[0]);
+    sc_position_free(positions[1]);
+    sc_generator_free(generator);
+    sc_lexicon_free(lexicon);
+
+    (void)status;
+    (void)found;
+    printf("PASSED: All C ABI tests passed.\n");
+    return 0;
+}
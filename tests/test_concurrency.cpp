@@ -0,0 +1,129 @@
+#include "SelfPlay.h"
+#include "test_support.h"
+#include "Rules.h"
+#include "Anagram.h"
+#include "Validation.h"
+#include "Server.h"
+#include <iostream>
+#include <thread>
+#include <atomic>
+#include <algorithm>
+#include <cassert>
+
+using namespace Scrabble;
+
+static const int THREADS = 8;
+static const int ROUNDS = 3;
+
+struct Position {
+    Board board;
+    std::vector<char> rack;
+    std::vector<std::string> moves;     // Reference answer, one line per move
+    std::string best;                   // Placement of the best move ("" if none)
+    std::vector<std::string> anagrams;
+};
+
+static std::vector<std::string> describe(const std::vector<Move>& moves) {
+    std::vector<std::string> out;
+    for (const Move& m : moves) {
+        std::string line = std::to_string(m.row) + " " + std::to_string(m.col) + (m.horizontal ? " H " : " V ") +
+                           m.word + " " + std::to_string(m.score) + " ";
+        for (int i = 0; i < m.tileCount; ++i) line += m.tiles[i].isBlank() ? '?' : m.tiles[i].letter;
+        out.push_back(line);
+    }
+    return out;
+}
+
+static std::vector<std::string> words(const std::vector<AnagramMatch>& matches) {
+    std::vector<std::string> out;
+    for (const AnagramMatch& m : matches) out.push_back(m.word);
+    return out;
+}
+
+int main() {
+    std::cout << "Starting Concurrency Test..." << std::endl;
+
+    Gaddag gaddag;
+    bool loaded = loadTestWords(gaddag, "test_concurrency_words.txt");
+    assert(loaded);
+    (void)loaded;
+
+    // Reference answers, computed on this thread alone
+    const MoveGenerator generator;
+    std::vector<Position> positions;
+    for (uint64_t g = 0; g < 3; ++g) {
+        Game game(gameSeed(21, g));
+        while (!game.isOver()) {
+            Position p;
+            p.board = game.getBoard();
+            p.rack = game.getRack(game.currentPlayer());
+            std::vector<Move> moves = generateScoredMoves(p.board, p.rack, generator, gaddag);
+            p.moves = describe(moves);
+            p.anagrams = words(findAnagrams(gaddag, std::string(p.rack.begin(), p.rack.end())));
+            int best = -1;
+            for (int i = 0; i < (int)moves.size(); ++i) {
+                if (best < 0 || moves[i].score > moves[best].score) best = i;
+            }
+            if (best >= 0) p.best = placementString(p.board, moves[best]);
+            positions.push_back(p);
+            if (best < 0 || !game.play(moves[best])) game.pass();
+        }
+    }
+    std::cout << positions.size() << " positions" << std::endl;
+
+    std::cout << "Testing " << THREADS << " threads sharing one dictionary and generator... ";
+    std::atomic<int> mismatches(0);
+    std::atomic<long> checks(0);
+    auto worker = [&](int id) {
+        GenContext context;
+        MoveCache cache;
+        for (int round = 0; round < ROUNDS; ++round) {
+            for (size_t k = 0; k < positions.size(); ++k) {
+                // Each thread walks the positions from a different offset
+                const Position& p = positions[(k + (size_t)id * 7) % positions.size()];
+                bool ok = true;
+                switch ((k + (size_t)id + (size_t)round) % 4) {
+                    case 0:
+                        ok = describe(generateScoredMoves(p.board, p.rack, generator, gaddag, context)) == p.moves;
+                        break;
+                    case 1:
+                        ok = describe(generateScoredMoves(p.board, p.rack, generator, gaddag, cache)) == p.moves;
+                        break;
+                    case 2:
+                        ok = describe(generateScoredMoves(p.board, p.rack, generator, gaddag)) == p.moves;
+                        break;
+                    default:
+                        ok = words(findAnagrams(gaddag, std::string(p.rack.begin(), p.rack.end()))) == p.anagrams;
+                        if (!p.best.empty()) ok = ok && validateMove(p.board, p.best, gaddag, p.rack).ok();
+                        break;
+                }
+                for (const char* w : TEST_WORDS) ok = ok && gaddag.contains(w);
+                ok = ok && !gaddag.contains("XYZZY") && !gaddag.contains("TRAINE");
+                if (!ok) mismatches++;
+                checks++;
+            }
+        }
+    };
+    std::vector<std::thread> threads;
+    for (int t = 1; t < THREADS; ++t) threads.emplace_back(worker, t);
+    worker(0);
+    for (std::thread& t : threads) t.join();
+    assert(mismatches == 0);
+    assert(checks == (long)(THREADS * ROUNDS * positions.size()));
+    std::cout << "OK (" << checks << " checks)" << std::endl;
+
+    std::cout << "Testing concurrent self-play against a single thread... ";
+    SelfPlayConfig config;
+    config.games = 16;
+    config.seed = 3;
+    config.threads = 1;
+    SelfPlayStats single = runSelfPlay(gaddag, config);
+    config.threads = THREADS;
+    SelfPlayStats parallel = runSelfPlay(gaddag, config);
+    assert(single.totalScore == parallel.totalScore && single.plays == parallel.plays &&
+           single.candidates == parallel.candidates);
+    std::cout << "OK" << std::endl;
+
+    std::cout << "All Concurrency Tests Passed!" << std::endl;
+    return 0;
+}
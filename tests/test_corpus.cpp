@@ -0,0 +1,116 @@
+#include "Corpus.h"
+#include "test_support.h"
+#include "Rules.h"
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include <algorithm>
+#include <cassert>
+#include <cstdio>
+
+using namespace Scrabble;
+
+static bool samePosition(const CorpusPosition& a, const CorpusPosition& b) {
+    return boardToString(a.board) == boardToString(b.board) && a.rack == b.rack &&
+           a.positionClass == b.positionClass;
+}
+
+static int countBlanks(const Board& board) {
+    int blanks = 0;
+    for (int r = 0; r < 15; ++r) {
+        for (int c = 0; c < 15; ++c) {
+            if (board.getTile(r, c).isBlank()) blanks++;
+        }
+    }
+    return blanks;
+}
+
+int main() {
+    std::cout << "Starting Corpus Test..." << std::endl;
+
+    Gaddag gaddag;
+    bool loaded = loadWords(gaddag, "test_corpus_words.txt", SMALL_WORDS);
+    assert(loaded);
+
+    std::cout << "Testing class names... ";
+    for (int i = 0; i < (int)PositionClass::Count; ++i) {
+        PositionClass parsed;
+        bool known = positionClassByName(positionClassName((PositionClass)i), parsed);
+        assert(known && parsed == (PositionClass)i);
+        (void)known;
+    }
+    PositionClass unused;
+    assert(!positionClassByName("endgame", unused));
+    (void)unused;
+    std::cout << "OK" << std::endl;
+
+    std::cout << "Testing stratified, reproducible generation... ";
+    CorpusConfig config;
+    config.count = 20;
+    config.seed = 7;
+    config.threads = 1;
+    std::vector<CorpusPosition> single = generateCorpus(gaddag, config);
+    config.threads = 4;
+    std::vector<CorpusPosition> multi = generateCorpus(gaddag, config);
+    assert(single.size() == 20 && multi.size() == 20);
+    for (size_t i = 0; i < single.size(); ++i) {
+        assert(samePosition(single[i], multi[i]));
+        assert(single[i].positionClass == (PositionClass)(i % (size_t)PositionClass::Count));
+        assert(!single[i].rack.empty() && single[i].rack.size() <= (size_t)RACK_SIZE);
+        // Never more blanks than the tile set holds
+        int rackBlanks = (int)std::count_if(single[i].rack.begin(), single[i].rack.end(), isBlankTile);
+        int blanks = rackBlanks + countBlanks(single[i].board);
+        assert(blanks <= letterCount(BLANK_TILE));
+        if (single[i].positionClass == PositionClass::BlankHeavy) {
+            assert(blanks == letterCount(BLANK_TILE) || rackBlanks == (int)single[i].rack.size());
+        }
+        (void)blanks;
+        (void)rackBlanks;
+    }
+    config.seed = 8;
+    std::vector<CorpusPosition> other = generateCorpus(gaddag, config);
+    bool differs = false;
+    for (size_t i = 0; i < other.size(); ++i) differs = differs || !samePosition(single[i], other[i]);
+    assert(differs);
+    (void)differs;
+    std::cout << "OK" << std::endl;
+
+    std::cout << "Testing text and binary output... ";
+    std::string textPath = "test_corpus.txt";
+    std::string binaryPath = "test_corpus.bin";
+    bool wroteText = writeCorpusText(textPath, single);
+    bool wroteBinary = writeCorpusBinary(binaryPath, single);
+    assert(wroteText && wroteBinary);
+
+    std::ifstream text(textPath);
+    std::string line;
+    size_t lines = 0;
+    while (std::getline(text, line)) {
+        assert(line.size() > 228 && line.compare(225, 3, " | ") == 0);
+        lines++;
+    }
+    assert(lines == single.size());
+
+    std::vector<CorpusPosition> loadedBack;
+    bool read = readCorpusBinary(binaryPath, loadedBack);
+    assert(read && loadedBack.size() == single.size());
+    for (size_t i = 0; i < single.size(); ++i) assert(samePosition(single[i], loadedBack[i]));
+
+    // A count larger than the file holds is rejected before anything is reserved
+    {
+        std::fstream patch(binaryPath, std::ios::binary | std::ios::in | std::ios::out);
+        uint32_t count = 0xFFFFFFF0u;
+        patch.seekp(12);
+        patch.write(reinterpret_cast<const char*>(&count), sizeof(count));
+    }
+    assert(!readCorpusBinary(binaryPath, loadedBack));
+    std::remove(textPath.c_str());
+    std::remove(binaryPath.c_str());
+    (void)wroteText;
+    (void)wroteBinary;
+    (void)read;
+    std::cout << "OK" << std::endl;
+
+    std::cout << "PASSED: All corpus tests passed." << std::endl;
+    return 0;
+}
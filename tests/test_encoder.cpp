@@ -0,0 +1,116 @@
+#include "Encoder.h"
+#include "test_support.h"
+#include "Rules.h"
+#include <iostream>
+#include <vector>
+#include <cstdint>
+#include <cassert>
+
+using namespace Scrabble;
+
+static float at(const float* sample, int plane, int row, int col) {
+    return sample[(size_t)plane * ENCODER_PLANE_STRIDE + row * 15 + col];
+}
+
+int main() {
+    std::cout << "Starting Encoder Test..." << std::endl;
+
+    Gaddag gaddag;
+    bool loaded = loadWords(gaddag, "test_encoder_words.txt", SMALL_WORDS);
+    assert(loaded);
+
+    MoveGenerator generator;
+    BoardEncoder encoder(gaddag, generator);
+
+    // CHAT on row 7 from column 3, with a blank H
+    Board board = boardFromString(std::string(105, '.') + "...ChAT" + std::string(113, '.'));
+    assert(board.getTile(7, 4).isBlank());
+
+    std::cout << "Testing position planes... ";
+    std::vector<Board> boards = {Board(), board};
+    std::vector<float> planes(boards.size() * ENCODER_SAMPLE_SIZE, -1.0f);
+    encoder.encodePositions(boards.data(), boards.size(), planes.data());
+
+    const float* empty = planes.data();
+    const float* filled = planes.data() + ENCODER_SAMPLE_SIZE;
+    assert(at(empty, ENCODER_PLANE_LETTERS + 'C' - 'A', 7, 3) == 0.0f);
+    assert(at(filled, ENCODER_PLANE_LETTERS + 'C' - 'A', 7, 3) == 1.0f);
+    assert(at(filled, ENCODER_PLANE_LETTERS + 'H' - 'A', 7, 4) == 1.0f);
+    assert(at(filled, ENCODER_PLANE_BLANK, 7, 4) == 1.0f);
+    assert(at(filled, ENCODER_PLANE_BLANK, 7, 3) == 0.0f);
+    assert(at(filled, ENCODER_PLANE_BONUS + 3, 0, 0) == 1.0f);  // Triple word corner
+    assert(at(filled, ENCODER_PLANE_BONUS + 0, 7, 3) == 1.0f);  // Double letter
+    // Padding stays zero
+    assert(filled[ENCODER_PLANE_STRIDE - 1] == 0.0f);
+
+    // Cross-checks match the generator's own tables
+    uint32_t horizontal[15][15];
+    uint32_t vertical[15][15];
+    generator.computeCrossChecks(board, gaddag, horizontal);
+    generator.computeCrossChecks(board.transposed(), gaddag, vertical);
+    for (int r = 0; r < 15; ++r) {
+        for (int c = 0; c < 15; ++c) {
+            for (int l = 0; l < 26; ++l) {
+                bool free = board.isEmpty(r, c);
+                float h = free && ((horizontal[r][c] >> l) & 1) ? 1.0f : 0.0f;
+                float v = free && ((vertical[c][r] >> l) & 1) ? 1.0f : 0.0f;
+                assert(at(filled, ENCODER_PLANE_CROSS_H + l, r, c) == h);
+                assert(at(filled, ENCODER_PLANE_CROSS_V + l, r, c) == v);
+            }
+        }
+    }
+    // Under T at (8,6), a horizontal play must form TA vertically (TS is not a word)
+    assert(at(filled, ENCODER_PLANE_CROSS_H + 'A' - 'A', 8, 6) == 1.0f);
+    assert(at(filled, ENCODER_PLANE_CROSS_H + 'S' - 'A', 8, 6) == 0.0f);
+    // Right after CHAT at (7,7), a vertical play must form CHATS
+    assert(at(filled, ENCODER_PLANE_CROSS_V + 'S' - 'A', 7, 7) == 1.0f);
+    assert(at(filled, ENCODER_PLANE_CROSS_V + 'E' - 'A', 7, 7) == 0.0f);
+
+    std::vector<float> direct(ENCODER_SAMPLE_SIZE);
+    encoder.encodePosition(board, horizontal, vertical, direct.data());
+    for (size_t i = 0; i < ENCODER_SAMPLE_SIZE; ++i) assert(direct[i] == filled[i]);
+    std::cout << "PASSED" << std::endl;
+
+    std::cout << "Testing move planes... ";
+    Move chats;
+    chats.row = 7; chats.col = 3; chats.horizontal = true; chats.word = "CHATS";
+    chats.tileCount = 1;
+    chats.tiles[0] = Tile('S', 1);
+    Move ta;
+    ta.row = 7; ta.col = 6; ta.horizontal = false; ta.word = "TA";
+    ta.tileCount = 1;
+    ta.tiles[0] = Tile('A', 0);
+
+    Move moves[2] = {chats, ta};
+    std::vector<uint8_t> movePlanes(2 * ENCODER_SAMPLE_SIZE);
+    encoder.encodeMoves(board, moves, 2, movePlanes.data());
+    const uint8_t* m0 = movePlanes.data();
+    const uint8_t* m1 = movePlanes.data() + ENCODER_SAMPLE_SIZE;
+    assert(m0[(ENCODER_PLANE_LETTERS + 'S' - 'A') * ENCODER_PLANE_STRIDE + 7 * 15 + 7] == 1);
+    assert(m0[ENCODER_PLANE_PLACED * ENCODER_PLANE_STRIDE + 7 * 15 + 7] == 1);
+    assert(m0[ENCODER_PLANE_PLACED * ENCODER_PLANE_STRIDE + 7 * 15 + 6] == 0);
+    assert(m1[(ENCODER_PLANE_LETTERS + 'A' - 'A') * ENCODER_PLANE_STRIDE + 8 * 15 + 6] == 1);
+    assert(m1[ENCODER_PLANE_BLANK * ENCODER_PLANE_STRIDE + 8 * 15 + 6] == 1);
+    assert(m1[ENCODER_PLANE_PLACED * ENCODER_PLANE_STRIDE + 7 * 15 + 7] == 0);
+    // Both samples keep the original tiles
+    assert(m1[(ENCODER_PLANE_LETTERS + 'C' - 'A') * ENCODER_PLANE_STRIDE + 7 * 15 + 3] == 1);
+    std::cout << "PASSED" << std::endl;
+
+    std::cout << "Testing plane alignment... ";
+    // Every plane of a uint8 sample starts on a 64-byte boundary of an aligned buffer
+    std::vector<uint8_t> bytes(2 * ENCODER_SAMPLE_SIZE + 64, 0xFF);
+    uint8_t* aligned = bytes.data() + (64 - (uintptr_t)bytes.data() % 64) % 64;
+    encoder.encodePositions(boards.data(), boards.size(), aligned);
+    for (size_t plane = 0; plane < 2 * (size_t)ENCODER_PLANES; ++plane) {
+        const uint8_t* start = aligned + plane * ENCODER_PLANE_STRIDE;
+        assert((uintptr_t)start % 64 == 0);
+        assert(((uintptr_t)planes.data() + plane * ENCODER_PLANE_STRIDE * sizeof(float)) % 64 ==
+               (uintptr_t)planes.data() % 64);
+        for (int i = 225; i < ENCODER_PLANE_STRIDE; ++i) assert(start[i] == 0);
+    }
+    assert(aligned[ENCODER_SAMPLE_SIZE + (size_t)(ENCODER_PLANE_LETTERS + 'H' - 'A') * ENCODER_PLANE_STRIDE + 7 * 15 + 4] == 1);
+    std::cout << "PASSED" << std::endl;
+
+    std::cout << "PASSED: All encoder tests passed." << std::endl;
+    return 0;
+}
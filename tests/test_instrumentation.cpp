@@ -0,0 +1,84 @@
+#include "Instrumentation.h"
+#include "test_support.h"
+#include "Game.h"
+#include "Rules.h"
+#include <iostream>
+#include <thread>
+#include <cassert>
+
+using namespace Scrabble;
+
+int main() {
+    std::cout << "Starting Instrumentation Test..." << std::endl;
+    std::cout << "Instrumentation " << (INSTRUMENTATION_ENABLED ? "enabled" : "disabled") << std::endl;
+
+    Gaddag gaddag;
+    bool loaded = loadWords(gaddag, "test_instrumentation_words.txt", SMALL_WORDS);
+    assert(loaded);
+
+    MoveGenerator generator;
+    Board board = boardFromString(std::string(105, '.') + "...CHAT" + std::string(113, '.'));
+    std::vector<char> rack = {'S', '?', 'A'};
+
+    resetCounters();
+    std::vector<Move> moves = generateScoredMoves(board, rack, generator, gaddag);
+    GenCounters c = collectCounters();
+
+    if (!INSTRUMENTATION_ENABLED) {
+        // Everything compiles away
+        assert(c.nodesVisited == 0 && c.movesRecorded == 0 && c.calls[StageTraversal] == 0);
+        std::cout << "PASSED: Counters compiled out." << std::endl;
+        return 0;
+    }
+
+    std::cout << "Testing counters... ";
+    assert(c.nodesVisited > 0);
+    assert(c.arcsTried >= c.crossCheckRejects);
+    assert(c.rackAttempts > 0);
+    assert(c.blankExpansions > 0);
+    assert(c.delimiterTransitions > 0);
+    // Every recorded move is either kept or dropped as a duplicate (or a skipped vertical single tile)
+    assert(c.movesRecorded >= moves.size() + c.duplicates);
+    // Two directions per call
+    assert(c.calls[StageCrossChecks] == 2 && c.calls[StageTraversal] == 2);
+    assert(c.calls[StageDedup] == 1 && c.calls[StageScoring] == 1);
+    std::cout << "OK" << std::endl;
+
+    std::cout << "Testing per-thread accumulation... ";
+    resetCounters();
+    std::thread worker([&]() {
+        generateScoredMoves(board, rack, generator, gaddag);
+        // Another thread's work does not show in this thread's counters
+        assert(threadCounters().nodesVisited == c.nodesVisited);
+    });
+    worker.join();
+    assert(threadCounters().nodesVisited == 0);
+    // Folded into the total when the thread exited
+    assert(collectCounters().nodesVisited == c.nodesVisited);
+    std::cout << "OK" << std::endl;
+
+    std::cout << "Testing that both traversal engines count the same work... ";
+    for (const Board& view : {board, board.transposed()}) {
+        for (const std::vector<char>& r : {rack, std::vector<char>{'S', 'A', 'H', 'T'}}) {
+            GenCounters engines[2];
+            for (int e = 0; e < 2; ++e) {
+                resetCounters();
+                if (e == 0) generator.generateMoves(view, r, gaddag);
+                else generator.generateMovesInterleaved(view, r, gaddag);
+                engines[e] = collectCounters();
+            }
+            assert(engines[0].nodesVisited == engines[1].nodesVisited);
+            assert(engines[0].arcsTried == engines[1].arcsTried);
+            assert(engines[0].crossCheckRejects == engines[1].crossCheckRejects);
+            assert(engines[0].rackAttempts == engines[1].rackAttempts);
+            assert(engines[0].blankExpansions == engines[1].blankExpansions);
+            assert(engines[0].delimiterTransitions == engines[1].delimiterTransitions);
+            assert(engines[0].movesRecorded == engines[1].movesRecorded);
+        }
+    }
+    std::cout << "OK" << std::endl;
+
+    printCounters(std::cout, c);
+    std::cout << "PASSED: All instrumentation tests passed." << std::endl;
+    return 0;
+}
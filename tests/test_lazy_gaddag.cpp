@@ -0,0 +1,203 @@
+#include "LazyGaddag.h"
+#include "test_support.h"
+#include "Server.h"
+#include "Rules.h"
+#include <iostream>
+#include <fstream>
+#include <thread>
+#include <cassert>
+#include <cstdio>
+
+using namespace Scrabble;
+
+static const std::string PAGED = "test_lazy_gaddag.lazy";
+
+void testPages(const Gaddag& gaddag) {
+    LazyGaddag lexicon;
+    assert(lexicon.open(PAGED, false));
+    assert(lexicon.pageCount() == (int)gaddag.getRoot()->children.size());
+    assert(lexicon.pagesLoaded() == 0 && !lexicon.isWarm());
+
+    // REVERSE(AS) + leaves the root through S only
+    assert(lexicon.contains("AS") && lexicon.pagesLoaded() == 1);
+    // Pivoting on A instead
+    assert(lexicon.contains("AS", 0) && lexicon.pagesLoaded() == 2);
+
+    for (const char* w : TEST_WORDS) {
+        std::string word(w);
+        assert(lexicon.contains(word));
+        for (size_t pivot = 0; pivot < word.size(); ++pivot) assert(lexicon.contains(word, pivot));
+        assert(!lexicon.contains(word + "Q") && !lexicon.contains(word + "Q", word.size() - 1));
+    }
+    assert(!lexicon.contains("") && !lexicon.contains("TRAI", 2));
+    assert(lexicon.isWarm() && lexicon.pagesLoaded() == lexicon.pageCount());
+    assert(!lexicon.isDamaged());
+
+    // Warm: the assembled graph holds every word
+    for (const char* w : TEST_WORDS) assert(lexicon.gaddag().contains(w));
+}
+
+// Plays greedy games on a lexicon opened cold for each game, checking every turn
+void testGames(const Gaddag& gaddag) {
+    MoveGenerator generator;
+    GenContext context;
+    LazyGaddag lexicon;
+    uint64_t opened = ~0ull;
+    playGreedyGames(gaddag, 23, [&](uint64_t g, const Game& game, const std::vector<Move>& plain) {
+        if (g != opened) {
+            assert(lexicon.open(PAGED, g % 2 == 1));
+            opened = g;
+        }
+        const std::vector<char>& rack = game.getRack(game.currentPlayer());
+        assert(sameMoves(plain, generateScoredMoves(game.getBoard(), rack, generator, lexicon, context)));
+    });
+}
+
+// First positions: only the pages of the rack and board letters are needed
+void testColdStart(const Gaddag& gaddag) {
+    LazyGaddag lexicon;
+    assert(lexicon.open(PAGED, false));
+    MoveGenerator generator;
+    Board board;
+    GenContext context;
+    std::vector<char> rack = {'R', 'A', 'T'};
+    assert(sameMoves(generateScoredMoves(board, rack, generator, gaddag),
+                     generateScoredMoves(board, rack, generator, lexicon, context)));
+    assert(lexicon.pagesLoaded() <= 3 && !lexicon.isWarm());
+
+    // Cross-checks pivot on the board tiles: the letters tried next to them add no page
+    applyMove(board, generateScoredMoves(board, rack, generator, gaddag).front());
+    int before = lexicon.pagesLoaded();
+    std::vector<char> same = {'R', 'T', 'A'};
+    assert(sameMoves(generateScoredMoves(board, same, generator, gaddag),
+                     generateScoredMoves(board, same, generator, lexicon, context)));
+    assert(lexicon.pagesLoaded() == before && !lexicon.isWarm());
+
+    // A blank walks every root edge
+    std::vector<char> blank = {'R', '?'};
+    assert(sameMoves(generateScoredMoves(board, blank, generator, gaddag),
+                     generateScoredMoves(board, blank, generator, lexicon, context)));
+    assert(lexicon.isWarm());
+}
+
+// Threads generating at once on a cold lexicon, loading the same pages
+void testConcurrentLoads(const Gaddag& gaddag) {
+    LazyGaddag lexicon;
+    assert(lexicon.open(PAGED, true));
+    Game game(gameSeed(29, 0));
+    for (int turn = 0; turn < 4 && !game.isOver(); ++turn) {
+        MoveGenerator generator;
+        std::vector<Move> moves = game.legalMoves(generator, gaddag);
+        if (moves.empty() || !game.play(moves[bestMove(moves)])) game.pass();
+    }
+    const Board board = game.getBoard();
+    const std::vector<char> rack = game.getRack(game.currentPlayer());
+    MoveGenerator generator;
+    std::vector<Move> expected = generateScoredMoves(board, rack, generator, gaddag);
+
+    std::vector<std::thread> threads;
+    bool ok[8];
+    for (int i = 0; i < 8; ++i) {
+        threads.emplace_back([&, i]() {
+            GenContext context;
+            ok[i] = sameMoves(expected, generateScoredMoves(board, rack, generator, lexicon, context));
+        });
+    }
+    for (std::thread& t : threads) t.join();
+    for (bool b : ok) assert(b);
+    lexicon.warmUp();
+    assert(lexicon.isWarm() && !lexicon.isDamaged());
+}
+
+void testServer(const Gaddag& gaddag) {
+    LazyGaddag lexicon;
+    assert(lexicon.open(PAGED, false));
+    SolverServer cold(lexicon, 2);
+    SolverServer reference(gaddag, 1);
+    MoveGenerator generator;
+
+    Board board;
+    applyMove(board, generateScoredMoves(board, {'T', 'R', 'A', 'I', 'N'}, generator, gaddag).front());
+    std::string line = boardToString(board) + " | SEL | top 5";
+    assert(cold.handle(line, generator) == reference.handle(line, generator));
+    assert(!lexicon.isWarm());
+
+    // Validation needs the whole dictionary
+    std::string moves = reference.handle(boardToString(board) + " | SEL | top 1", generator);
+    std::string placement = moves.substr(moves.find('\n') + 1, 225);
+    std::string validate = boardToString(board) + " | SEL | validate " + placement;
+    assert(cold.handle(validate, generator) == reference.handle(validate, generator));
+    assert(lexicon.isWarm());
+    assert(cold.submit(line).get() == reference.handle(line, generator));
+}
+
+void testDamagedFiles() {
+    // Wrong magic
+    {
+        std::ofstream out("test_lazy_gaddag_bad.lazy", std::ios::binary);
+        out << "not a paged dictionary";
+    }
+    LazyGaddag lexicon;
+    assert(!lexicon.open("test_lazy_gaddag_bad.lazy") && lexicon.pageCount() == 0);
+    assert(!lexicon.contains("AS"));
+    assert(!lexicon.open("missing_lazy_gaddag.lazy"));
+
+    // Truncated: the page table points past the end
+    std::ifstream in(PAGED, std::ios::binary);
+    std::string data((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    {
+        std::ofstream out("test_lazy_gaddag_bad.lazy", std::ios::binary);
+        out.write(data.data(), (std::streamsize)(data.size() - 16));
+    }
+    assert(!lexicon.open("test_lazy_gaddag_bad.lazy"));
+
+    // A corrupt page is found when loaded, and reads as empty
+    {
+        std::string corrupt = data;
+        corrupt[corrupt.size() - 1] ^= 0x7F;
+        std::ofstream out("test_lazy_gaddag_bad.lazy", std::ios::binary);
+        out.write(corrupt.data(), (std::streamsize)corrupt.size());
+    }
+    assert(lexicon.open("test_lazy_gaddag_bad.lazy", false));
+    lexicon.warmUp();
+    assert(lexicon.isWarm() && lexicon.isDamaged());
+    std::remove("test_lazy_gaddag_bad.lazy");
+}
+
+int main() {
+    std::cout << "Starting Lazy GADDAG Test..." << std::endl;
+
+    Gaddag gaddag;
+    bool loaded = loadTestWords(gaddag, "test_lazy_gaddag_words.txt");
+    assert(loaded);
+    (void)loaded;
+    assert(LazyGaddag::savePaged(gaddag, PAGED));
+
+    std::cout << "Testing page loading and lookups... ";
+    testPages(gaddag);
+    std::cout << "OK" << std::endl;
+
+    std::cout << "Testing generation against the full dictionary... ";
+    testGames(gaddag);
+    std::cout << "OK" << std::endl;
+
+    std::cout << "Testing a cold start... ";
+    testColdStart(gaddag);
+    std::cout << "OK" << std::endl;
+
+    std::cout << "Testing concurrent page loads... ";
+    testConcurrentLoads(gaddag);
+    std::cout << "OK" << std::endl;
+
+    std::cout << "Testing the server on a cold dictionary... ";
+    testServer(gaddag);
+    std::cout << "OK" << std::endl;
+
+    std::cout << "Testing damaged files... ";
+    testDamagedFiles();
+    std::cout << "OK" << std::endl;
+
+    std::remove(PAGED.c_str());
+    std::cout << "All Lazy GADDAG Tests Passed!" << std::endl;
+    return 0;
+}
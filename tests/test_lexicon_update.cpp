@@ -0,0 +1,119 @@
+#include "LexiconUpdate.h"
+#include "test_support.h"
+#include <iostream>
+#include <fstream>
+#include <cassert>
+#include <cstdio>
+
+using namespace Scrabble;
+
+static void build(Gaddag& gaddag, const std::vector<std::string>& words) {
+    for (const std::string& word : words) gaddag.addWord(word);
+}
+
+void testEdits(const std::vector<std::string>& words) {
+    Gaddag gaddag;
+    for (const std::string& word : words) assert(gaddag.addWord(word));
+    assert(!gaddag.addWord("train") && !gaddag.addWord("  ") && !gaddag.removeWord("TRAINS"));
+
+    // Prefixes, suffixes and words sharing most of their paths with others
+    LexiconDelta delta = {
+        {true, "TRAINS"}, {true, "TRAINE"}, {false, "TRAIN"}, {false, "RE"}, {true, "ZEN"},
+        {false, "SATIN"}, {true, "RE"}, {false, "RE"}, {true, "AS"}, {false, "XYZ"},
+    };
+    DeltaStats stats = applyDelta(gaddag, delta);
+    assert(stats.added == 4 && stats.removed == 4 && stats.alreadyPresent == 1 && stats.notFound == 1);
+    assert(gaddag.contains("TRAINS") && gaddag.contains("TRAINE") && gaddag.contains("TRAINES"));
+    assert(!gaddag.contains("TRAIN") && !gaddag.contains("RE") && !gaddag.contains("SATIN"));
+    assert(gaddag.contains("RENTE") && gaddag.contains("ZEN") && gaddag.contains("SA"));
+
+    // Same graph as a rebuild, down to the node count
+    std::string difference;
+    assert(verifyDelta(words, delta, gaddag, &difference));
+    Gaddag rebuilt;
+    build(rebuilt, applyDelta(words, delta));
+    assert(countNodes(gaddag.getRoot()) == countNodes(rebuilt.getRoot()));
+
+    // A missed prune or a stray terminal is caught
+    Gaddag other;
+    build(other, applyDelta(words, delta));
+    other.addWord("ZENS");
+    assert(!sameGraph(gaddag, other, &difference) && !difference.empty());
+    other.removeWord("ZENS");
+    assert(sameGraph(gaddag, other));
+
+    // Moves come from the updated graph
+    MoveGenerator generator;
+    Board board;
+    std::vector<char> rack = {'T', 'R', 'A', 'I', 'N', 'S', 'E'};
+    std::vector<Move> updated = generateScoredMoves(board, rack, generator, gaddag);
+    std::vector<Move> full = generateScoredMoves(board, rack, generator, rebuilt);
+    assert(updated.size() == full.size());
+    for (size_t i = 0; i < full.size(); ++i) assert(updated[i].word == full[i].word && updated[i].score == full[i].score);
+
+    // Removing everything leaves the bare root
+    for (const std::string& word : applyDelta(words, delta)) assert(gaddag.removeWord(word));
+    assert(gaddag.getRoot()->children.empty());
+}
+
+void testFiles(const std::vector<std::string>& words) {
+    std::string path = "test_lexicon_update_delta.txt";
+    {
+        std::ofstream out(path);
+        out << "# house list\n+trains\n\n  - train \n+ZEN\r\n-XYZ\n";
+    }
+    LexiconDelta delta;
+    assert(loadDelta(path, delta) && delta.size() == 4);
+    assert(delta[0].add && delta[0].word == "TRAINS" && !delta[1].add && delta[1].word == "TRAIN");
+    {
+        std::ofstream out(path);
+        out << "+OK\nMISSING\n";
+    }
+    assert(!loadDelta(path, delta));
+    {
+        std::ofstream out(path);
+        out << "+\n";
+    }
+    assert(!loadDelta(path, delta));
+    std::remove(path.c_str());
+    assert(!loadDelta("missing_delta.txt", delta));
+
+    // Word list reading matches loadFromFile
+    {
+        std::ofstream out(path);
+        for (const std::string& word : words) out << " " << word << "\r\n";
+        out << "\n";
+    }
+    std::vector<std::string> read;
+    Gaddag fromFile;
+    assert(loadWordList(path, read) && read == words && fromFile.loadFromFile(path));
+    std::remove(path.c_str());
+    Gaddag fromList;
+    build(fromList, read);
+    assert(sameGraph(fromFile, fromList));
+
+    // The updated binary loads back to the same graph
+    delta = {{true, "TRAINS"}, {false, "TRAIN"}};
+    applyDelta(fromFile, delta);
+    assert(fromFile.saveBinary("test_lexicon_update.bin"));
+    Gaddag loaded;
+    assert(loaded.loadBinary("test_lexicon_update.bin"));
+    std::remove("test_lexicon_update.bin");
+    assert(sameGraph(fromFile, loaded) && verifyDelta(words, delta, loaded));
+}
+
+int main() {
+    std::cout << "Starting Lexicon Update Test..." << std::endl;
+    std::vector<std::string> words(TEST_WORDS, TEST_WORDS + TEST_WORD_COUNT);
+
+    std::cout << "Testing additions and removals against a rebuild... ";
+    testEdits(words);
+    std::cout << "OK" << std::endl;
+
+    std::cout << "Testing delta files and word lists... ";
+    testFiles(words);
+    std::cout << "OK" << std::endl;
+
+    std::cout << "All Lexicon Update Tests Passed!" << std::endl;
+    return 0;
+}
@@ -0,0 +1,106 @@
+#include "test_support.h"
+#include "Rules.h"
+#include <iostream>
+#include <fstream>
+#include <algorithm>
+#include <cassert>
+#include <cstdio>
+
+using namespace Scrabble;
+
+// Plays greedy games and checks every turn against uncached generation
+void testGames(const Gaddag& gaddag, MoveCache& cache) {
+    MoveGenerator generator;
+    playGreedyGames(gaddag, 11, [&](uint64_t, const Game& game, const std::vector<Move>& plain) {
+        assert(sameMoves(plain, game.legalMoves(generator, gaddag, cache)));
+
+        // Opponent replies to a few candidates: most lines are unchanged between them
+        std::vector<char> rack = game.getRack(1 - game.currentPlayer());
+        for (size_t i = 0; i < plain.size() && i < 4; ++i) {
+            Board next = game.getBoard();
+            applyMove(next, plain[i]);
+            assert(sameMoves(generateScoredMoves(next, rack, generator, gaddag),
+                             generateScoredMoves(next, rack, generator, gaddag, cache)));
+        }
+    });
+}
+
+int main() {
+    std::cout << "Starting Move Cache Test..." << std::endl;
+
+    std::string path = "test_move_cache_words.txt";
+    Gaddag gaddag;
+    bool loaded = loadTestWords(gaddag, path);
+    assert(loaded);
+    (void)loaded;
+
+    std::cout << "Testing cached generation against full generation... ";
+    MoveCache cache;
+    testGames(gaddag, cache);
+    assert(cache.hits() > 0 && cache.misses() > 0);
+    assert(cache.crossCheckHits() > cache.crossCheckMisses());
+    std::cout << "OK (" << cache.hits() << " line hits, " << cache.misses() << " misses)" << std::endl;
+
+    std::cout << "Testing a tiny cache that keeps evicting... ";
+    MoveCache tiny(8);
+    testGames(gaddag, tiny);
+    std::cout << "OK" << std::endl;
+
+    std::cout << "Testing rack order and blank spelling... ";
+    Board board;
+    MoveGenerator generator;
+    std::vector<char> rack = {'T', 'R', 'A', 'I', 'N', 'E', '?'};
+    std::vector<char> shuffled = {'*', 'E', 'N', 'I', 'A', 'R', 'T'};
+    size_t misses = cache.misses();
+    std::vector<Move> first = generateScoredMoves(board, rack, generator, gaddag, cache);
+    std::vector<Move> second = generateScoredMoves(board, shuffled, generator, gaddag, cache);
+    assert(sameMoves(first, second) && sameMoves(first, generateScoredMoves(board, rack, generator, gaddag)));
+    assert(cache.misses() <= misses + 2);
+    std::cout << "OK" << std::endl;
+
+    std::cout << "Testing that a new or updated dictionary resets the cache... ";
+    Gaddag other;
+    {
+        std::ofstream out(path);
+        out << "TRAINE\nAN\nNE\n";
+    }
+    loaded = other.loadFromFile(path);
+    std::remove(path.c_str());
+    assert(loaded);
+    std::vector<Move> fresh = generateScoredMoves(board, rack, generator, other, cache);
+    assert(sameMoves(fresh, generateScoredMoves(board, rack, generator, other)));
+    assert(sameMoves(first, generateScoredMoves(board, rack, generator, gaddag, cache)));
+
+    // Same dictionary object, changed in place: edited, then reloaded
+    fresh = generateScoredMoves(board, rack, generator, other, cache);
+    assert(other.addWord("RIANT"));
+    std::vector<Move> edited = generateScoredMoves(board, rack, generator, other, cache);
+    assert(edited.size() > fresh.size() && sameMoves(edited, generateScoredMoves(board, rack, generator, other)));
+    assert(gaddag.saveBinary("test_move_cache.bin") && other.loadBinary("test_move_cache.bin"));
+    std::remove("test_move_cache.bin");
+    assert(sameMoves(first, generateScoredMoves(board, rack, generator, other, cache)));
+    std::cout << "OK" << std::endl;
+
+    std::cout << "Testing self-play with the cache... ";
+    SelfPlayConfig config;
+    config.games = 4;
+    config.seed = 5;
+    SelfPlayStats stats = runSelfPlay(gaddag, config);
+    SelfPlayStats uncached;
+    MovePolicy* policies[Game::NUM_PLAYERS];
+    std::unique_ptr<MovePolicy> greedy[Game::NUM_PLAYERS];
+    MoveGenerator worker;
+    for (int p = 0; p < Game::NUM_PLAYERS; ++p) {
+        greedy[p] = policyByName("greedy")(0);
+        policies[p] = greedy[p].get();
+    }
+    for (int g = 0; g < config.games; ++g) {
+        Game game(gameSeed(config.seed, (uint64_t)g));
+        playGame(game, policies, worker, gaddag, uncached);
+    }
+    assert(stats.totalScore == uncached.totalScore && stats.plays == uncached.plays);
+    std::cout << "OK" << std::endl;
+
+    std::cout << "All Move Cache Tests Passed!" << std::endl;
+    return 0;
+}
@@ -1,10 +1,43 @@
 #include "MoveGenerator.h"
+#include "test_support.h"
+#include "Game.h"
+#include "Rules.h"
 #include <iostream>
 #include <vector>
+#include <algorithm>
 #include <cassert>
 
 using namespace Scrabble;
 
+// Word span of a move in its own direction, and for a single tile the perpendicular word too
+static bool touchesMask(const Board& board, const Move& m, const SquareMask& mask) {
+    int dr = m.horizontal ? 0 : 1, dc = m.horizontal ? 1 : 0;
+    for (size_t i = 0; i < m.word.length(); ++i) {
+        if (mask.test(m.row + dr * (int)i, m.col + dc * (int)i)) return true;
+    }
+    if (m.tileCount != 1) return false;
+    int r = m.row, c = m.col;
+    while (!board.isEmpty(r, c)) { r += dr; c += dc; }
+    // The placed square is empty on the board, so walk its perpendicular neighbours
+    int first = 0, last = 0;
+    while (!board.getTile(r - dc * (1 - first), c - dr * (1 - first)).isEmpty()) first--;
+    while (!board.getTile(r + dc * (last + 1), c + dr * (last + 1)).isEmpty()) last++;
+    int length = last - first + 1;
+    bool hit = false;
+    for (int i = first; i <= last; ++i) hit = hit || mask.test(r + dc * i, c + dr * i);
+    return length >= 2 && hit;
+}
+
+static std::vector<std::string> keys(const std::vector<Move>& moves) {
+    std::vector<std::string> out;
+    for (const Move& m : moves) {
+        out.push_back(std::to_string(m.row) + " " + std::to_string(m.col) + (m.horizontal ? " H " : " V ") +
+                      m.word + " " + std::to_string(m.score));
+    }
+    std::sort(out.begin(), out.end());
+    return out;
+}
+
 int main() {
     std::cout << "Starting MoveGenerator Test..." << std::endl;
 
@@ -12,17 +45,125 @@ int main() {
     Gaddag gaddag;
     // We don't necessarily need to load the huge dictionary for a skeleton test
     // But for a real test we would.
-    
+
     MoveGenerator moveGen;
     std::vector<char> rack = {'A', 'B', 'C', 'D', 'E', 'F', 'G'};
-    
+
     std::cout << "Generating moves..." << std::endl;
     std::vector<Move> moves = moveGen.generateMoves(board, rack, gaddag);
-    
+
     std::cout << "Generated " << moves.size() << " moves." << std::endl;
-    
+
     // Since implementation is empty, it should be 0 or throw if we had logic
     // Currently it returns empty vector.
-    
+
+    bool loaded = loadWords(gaddag, "test_move_generator_words.txt", SMALL_WORDS);
+    assert(loaded);
+    (void)loaded;
+
+    std::cout << "Testing square-constrained generation... ";
+    SquareMask none;
+    assert(none.empty() && moveGen.generateMoves(board, rack, gaddag, none).empty());
+    SquareMask corner;
+    corner.set(2, 9);
+    assert(corner.transposed().test(9, 2) && !corner.transposed().test(2, 9));
+    assert(corner.touches(2, 0, 9) && !corner.touches(2, 10, 14) && !corner.touches(3, 0, 14));
+
+    size_t checked = 0, restricted = 0;
+    for (uint64_t seed = 1; seed <= 4; ++seed) {
+        Game game(seed);
+        for (int turn = 0; turn < 10 && !game.isOver(); ++turn) {
+            const Board& current = game.getBoard();
+            const std::vector<char>& hand = game.getRack(game.currentPlayer());
+            std::vector<Move> all = game.legalMoves(moveGen, gaddag);
+
+            // A single square, a premium square, a 3x3 region and a full row
+            SquareMask masks[4];
+            masks[0].set(7, 7);
+            masks[1].set(0, 0);
+            masks[1].set(3, 7);
+            for (int r = 6; r <= 8; ++r) {
+                for (int c = (int)seed + 2; c <= (int)seed + 4; ++c) masks[2].set(r, c);
+            }
+            for (int c = 0; c < 15; ++c) masks[3].set(6 + turn % 3, c);
+
+            for (const SquareMask& mask : masks) {
+                std::vector<Move> expected;
+                for (const Move& m : all) {
+                    if (touchesMask(current, m, mask)) expected.push_back(m);
+                }
+                std::vector<Move> got = generateScoredMoves(current, hand, moveGen, gaddag, mask);
+                assert(keys(got) == keys(expected));
+                checked += got.size();
+                restricted += all.size() - got.size();
+            }
+            if (all.empty()) game.pass();
+            else game.play(all[0]);
+        }
+    }
+    assert(checked > 0 && restricted > 0);
+    std::cout << "OK (" << checked << " moves)" << std::endl;
+
+    std::cout << "Testing budget-bounded search... ";
+    size_t partial = 0;
+    for (uint64_t seed = 1; seed <= 4; ++seed) {
+        Game game(seed);
+        for (int turn = 0; turn < 10 && !game.isOver(); ++turn) {
+            const Board& current = game.getBoard();
+            const std::vector<char>& hand = game.getRack(game.currentPlayer());
+            std::vector<Move> all = game.legalMoves(moveGen, gaddag);
+            std::vector<std::string> expected = keys(all);
+
+            SearchBudget unlimited;
+            MoveSearchResult full = searchScoredMoves(current, hand, moveGen, gaddag, unlimited);
+            assert(full.complete && full.anchorsSearched == full.anchorsTotal && keys(full.moves) == expected);
+
+            // Cut short: fewer anchors, and every move found is a legal one
+            for (uint64_t limit : {1, 20, 200}) {
+                SearchBudget budget;
+                budget.maxNodes = limit;
+                MoveSearchResult cut = searchScoredMoves(current, hand, moveGen, gaddag, budget);
+                assert(cut.complete == !budget.expired && cut.anchorsSearched <= cut.anchorsTotal);
+                std::vector<std::string> found = keys(cut.moves);
+                assert(std::includes(expected.begin(), expected.end(), found.begin(), found.end()));
+                if (!cut.complete) partial++;
+            }
+            SearchBudget late = SearchBudget::within(std::chrono::microseconds(0));
+            MoveSearchResult lateResult = searchScoredMoves(current, hand, moveGen, gaddag, late);
+            assert(lateResult.moves.size() <= all.size());
+
+            if (all.empty()) game.pass();
+            else game.play(all[0]);
+        }
+    }
+    assert(partial > 0);
+    std::cout << "OK" << std::endl;
+
+    std::cout << "Testing the interleaved traversal... ";
+    size_t compared = 0;
+    GenContext context;
+    for (uint64_t seed = 1; seed <= 4; ++seed) {
+        Game game(seed);
+        for (int turn = 0; turn < 12 && !game.isOver(); ++turn) {
+            const Board& current = game.getBoard();
+            std::vector<char> hand = game.getRack(game.currentPlayer());
+            std::vector<char> blank = hand;
+            blank.push_back('?');
+            // Both directions, with and without blanks (more anchors than lanes on later turns)
+            for (const Board& b : {current, current.transposed()}) {
+                for (const std::vector<char>& r : {hand, blank, std::vector<char>{'?', '?'}}) {
+                    std::vector<std::string> expected = keys(moveGen.generateMoves(b, r, gaddag));
+                    assert(keys(moveGen.generateMovesInterleaved(b, r, gaddag, context)) == expected);
+                    compared += expected.size();
+                }
+            }
+            std::vector<Move> all = game.legalMoves(moveGen, gaddag);
+            if (all.empty()) game.pass();
+            else game.play(all[0]);
+        }
+    }
+    assert(compared > 0 && moveGen.generateMovesInterleaved(board, {}, gaddag).empty());
+    std::cout << "OK (" << compared << " moves)" << std::endl;
+
     return 0;
 }
@@ -0,0 +1,155 @@
+#include "Openings.h"
+#include "test_support.h"
+#include "SelfPlay.h"
+#include "Rules.h"
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <cassert>
+#include <cstdio>
+#include <iterator>
+
+using namespace Scrabble;
+
+int main() {
+    std::cout << "Starting Openings Test..." << std::endl;
+
+    Gaddag gaddag;
+    bool loaded = loadWords(gaddag, "test_openings_words.txt", SMALL_WORDS);
+    // Longer words, so some 7-tile racks have several openings
+    for (const char* w : {"ETALES", "SALINE", "LAINE", "TEINT"}) loaded = loaded && gaddag.addWord(w);
+    assert(loaded);
+    (void)loaded;
+
+    std::cout << "Testing the rack hash... ";
+    uint32_t a, b;
+    assert(rackRank({'C', 'H', 'A', 'T', 'S', '?', 'E'}, a) && rackRank({'e', '*', 's', 't', 'a', 'h', 'c'}, b) && a == b);
+    assert(!rackRank({'C', 'H', 'A', 'T'}, a) && !rackRank({'C', 'H', 'A', 'T', 'S', 'E', '1'}, a));
+    std::vector<bool> seen(OPENING_SLOTS, false);
+    size_t racks = 0;
+    forEachOpeningRack(2, [&](const std::vector<char>& rack) {
+        uint32_t rank;
+        bool ok = rackRank(rack, rank);
+        assert(ok && rank < OPENING_SLOTS && !seen[rank]);
+        (void)ok;
+        seen[rank] = true;
+        racks++;
+    });
+    assert(racks == 2954029);
+    std::cout << "OK (" << racks << " racks)" << std::endl;
+
+    // Racks dealt first in a few seeded games, plus some with words
+    OpeningBuildConfig config;
+    config.movesPerRack = 3;
+    config.threads = 2;
+    config.racks = {"SALINET", "ETALES?", "CHATSAE", "QQQQQQQ"};
+    for (uint64_t g = 0; g < 16; ++g) {
+        Game game(gameSeed(7, g));
+        for (int p = 0; p < Game::NUM_PLAYERS; ++p) {
+            const std::vector<char>& rack = game.getRack(p);
+            config.racks.push_back(std::string(rack.begin(), rack.end()));
+        }
+    }
+    std::string tablePath = "test_openings.tbl";
+    std::cout << "Testing the table against generation... ";
+    assert(!buildOpeningTable(gaddag, tablePath, OpeningBuildConfig{3, 1, 2, {"CHAT"}}));
+    bool built = buildOpeningTable(gaddag, tablePath, config);
+    assert(built);
+    (void)built;
+
+    OpeningTable table;
+    bool opened = table.open(tablePath, gaddag);
+    assert(opened && table.movesPerRack() == 3);
+    (void)opened;
+    MoveGenerator generator;
+    Board empty;
+    size_t served = 0;
+    for (const std::string& text : config.racks) {
+        std::vector<char> rack(text.begin(), text.end());
+        std::vector<Move> full = generateScoredMoves(empty, rack, generator, gaddag);
+        std::vector<Move> fast;
+        bool found = table.lookup(rack, fast);
+        if (full.empty()) {
+            assert(!found);
+            continue;
+        }
+        assert(found && fast.size() <= 2 * (size_t)table.movesPerRack());
+        served++;
+        int best = 0;
+        for (const Move& m : full) best = std::max(best, m.score);
+        for (const Move& m : fast) {
+            bool present = std::any_of(full.begin(), full.end(), [&](const Move& f) {
+                return f.row == m.row && f.col == m.col && f.horizontal == m.horizontal && f.word == m.word &&
+                       f.score == m.score && f.tileCount == m.tileCount;
+            });
+            assert(present);
+            (void)present;
+        }
+        // The greedy choice is the same move
+        GreedyPolicy greedy;
+        Game dummy(1);
+        const Move& pickedFull = full[greedy.selectMove(dummy, full)];
+        const Move& pickedFast = fast[greedy.selectMove(dummy, fast)];
+        assert(pickedFast.score == best && pickedFull.row == pickedFast.row && pickedFull.col == pickedFast.col &&
+               pickedFull.horizontal == pickedFast.horizontal && pickedFull.word == pickedFast.word);
+    }
+    std::vector<Move> unused;
+    assert(!table.lookup({'Z', 'Z', 'Y', 'Y', 'X', 'X', 'W'}, unused));
+    assert(served > 0);
+    std::cout << "OK (" << served << " racks)" << std::endl;
+
+    std::cout << "Testing the self-play fast path... ";
+    SelfPlayConfig play;
+    play.games = 16;
+    play.seed = 7;
+    SelfPlayStats plain = runSelfPlay(gaddag, play);
+    play.openings = &table;
+    SelfPlayStats fast = runSelfPlay(gaddag, play);
+    assert(plain.totalScore == fast.totalScore && plain.plays == fast.plays);
+    assert(fast.candidates < plain.candidates);
+    std::cout << "OK" << std::endl;
+
+    std::cout << "Testing table checks on open... ";
+    {
+        // Same table, another word list
+        Gaddag other;
+        bool added = other.addWord("CHAT") && other.addWord("CHATS");
+        assert(added && !table.open(tablePath, other));
+        (void)added;
+        table.open(tablePath, gaddag);
+    }
+    std::string data;
+    {
+        std::ifstream in(tablePath, std::ios::binary);
+        data.assign((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    }
+    // Offsets start after the 48-byte header; the rack slots are mostly empty
+    uint32_t rank;
+    rackRank({'S', 'A', 'L', 'I', 'N', 'E', 'T'}, rank);
+    const size_t slotAt = 48 + 4 * (size_t)rank;
+    std::vector<std::string> corrupt;
+    corrupt.push_back(data);
+    corrupt.back()[slotAt + 4] = corrupt.back()[slotAt] - 1;                // Decreasing offsets
+    corrupt.push_back(data);
+    corrupt.back()[48 + 4 * (size_t)OPENING_SLOTS] ^= 1;                    // Last offset is not the move count
+    corrupt.push_back(data);
+    corrupt.back()[12] = 1;                                                 // More moves than the rack limit
+    std::string corruptPath = "test_openings_corrupt.tbl";
+    for (const std::string& c : corrupt) {
+        {
+            std::ofstream out(corruptPath, std::ios::binary | std::ios::trunc);
+            out.write(c.data(), (std::streamsize)c.size());
+        }
+        OpeningTable damaged;
+        assert(!damaged.open(corruptPath, gaddag));
+    }
+    std::remove(corruptPath.c_str());
+    std::cout << "OK" << std::endl;
+
+    table.close();
+    std::remove(tablePath.c_str());
+    std::cout << "All Openings Tests Passed!" << std::endl;
+    return 0;
+}
@@ -0,0 +1,139 @@
+#include "Pattern.h"
+#include "test_support.h"
+#include <iostream>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <regex>
+#include <cassert>
+
+using namespace Scrabble;
+
+static const char* WORDS[] = {"CHAT", "CHATS", "ACHAT", "AS", "TA", "AH", "HA", "CAR", "CARS", "CUIR", "COEUR",
+                              "QUI", "QAT", "QATS", "COQ", "CINQ", "SAC", "ARTS", "STAR", "RATS", "CARRE", "CAREE",
+                              "ABACA", "ANANAS", "BANANE"};
+
+static std::vector<std::string> search(const Gaddag& gaddag, const PatternQuery& query) {
+    std::vector<std::string> out;
+    std::string error;
+    bool ok = searchPattern(gaddag, query, [&](const std::string& w) { out.push_back(w); }, error);
+    assert(ok);
+    (void)ok;
+    std::sort(out.begin(), out.end());
+    return out;
+}
+
+static std::vector<std::string> search(const Gaddag& gaddag, const std::string& pattern) {
+    PatternQuery query;
+    query.pattern = pattern;
+    return search(gaddag, query);
+}
+
+typedef std::vector<std::string> Words;
+
+// Reference: a regex over the word list, then the letter constraints
+static Words bruteForce(const PatternQuery& query) {
+    std::string expression;
+    for (char c : query.pattern) {
+        if (c == '?') expression += "[A-Z]";
+        else if (c == '*') expression += "[A-Z]*";
+        else expression += c;
+    }
+    std::regex re(expression);
+    Words out;
+    for (const char* w : WORDS) {
+        std::string word = w;
+        if (!std::regex_match(word, re)) continue;
+        if (word.find_first_of(query.exclude) != std::string::npos) continue;
+        bool holds = true;
+        for (char c : query.include) {
+            holds = holds && std::count(word.begin(), word.end(), c) >= std::count(query.include.begin(), query.include.end(), c);
+        }
+        if (holds) out.push_back(word);
+    }
+    std::sort(out.begin(), out.end());
+    return out;
+}
+
+int main() {
+    std::cout << "Starting Pattern Test..." << std::endl;
+
+    Gaddag gaddag;
+    bool loaded = loadWords(gaddag, "test_pattern_words.txt", WORDS);
+    assert(loaded);
+    (void)loaded;
+
+    std::cout << "Testing parsing... ";
+    std::vector<PatternToken> tokens;
+    std::string error;
+    assert(parsePattern("c?[ae]**[^q]", tokens, error) && tokens.size() == 5);
+    assert(tokens[0].letters == (1u << 2) && !tokens[0].repeat);
+    assert(tokens[2].letters == ((1u << 0) | (1u << 4)) && tokens[3].repeat);
+    assert((tokens[4].letters & (1u << ('Q' - 'A'))) == 0 && (tokens[4].letters & 1u));
+    assert(!parsePattern("C[AE", tokens, error) && !parsePattern("C1", tokens, error));
+    assert(!parsePattern("", tokens, error) && !parsePattern("[^ABCDEFGHIJKLMNOPQRSTUVWXYZ]", tokens, error));
+    PatternQuery broken;
+    broken.pattern = "C#";
+    assert(!searchPattern(gaddag, broken, [](const std::string&) {}, error));
+    std::cout << "OK" << std::endl;
+
+    std::cout << "Testing fixed letters and wildcards... ";
+    assert(search(gaddag, "CHAT") == Words({"CHAT"}));
+    assert(search(gaddag, "C?R*") == Words({"CAR", "CAREE", "CARRE", "CARS"}));
+    assert(search(gaddag, "C??R") == Words({"CUIR"}));
+    assert(search(gaddag, "*S") == Words({"ANANAS", "ARTS", "AS", "CARS", "CHATS", "QATS", "RATS"}));
+    assert(search(gaddag, "*AN*") == Words({"ANANAS", "BANANE"}));
+    assert(search(gaddag, "A?A?A?") == Words({"ANANAS"}));
+    assert(search(gaddag, "?A?A?A").empty());
+    assert(search(gaddag, "A*A") == Words({"ABACA"}));
+    assert(search(gaddag, "[CQ]*").size() == 13);
+    assert(search(gaddag, "[^C]A*") == Words({"BANANE", "HA", "QAT", "QATS", "RATS", "SAC", "TA"}));
+    assert(search(gaddag, "*").size() == sizeof(WORDS) / sizeof(WORDS[0]));
+    assert(search(gaddag, "**??").size() == sizeof(WORDS) / sizeof(WORDS[0]));
+    std::cout << "OK" << std::endl;
+
+    std::cout << "Testing letter constraints... ";
+    PatternQuery qNoU;
+    qNoU.pattern = "*";
+    qNoU.include = "Q";
+    qNoU.exclude = "U";
+    assert(search(gaddag, qNoU) == Words({"CINQ", "COQ", "QAT", "QATS"}));
+    PatternQuery lengths;
+    lengths.pattern = "*";
+    lengths.minLength = 5;
+    lengths.maxLength = 5;
+    assert(search(gaddag, lengths) == Words({"ABACA", "ACHAT", "CAREE", "CARRE", "CHATS", "COEUR"}));
+    PatternQuery twoR;
+    twoR.pattern = "C*";
+    twoR.include = "RR";
+    assert(search(gaddag, twoR) == Words({"CARRE"}));
+    std::cout << "OK" << std::endl;
+
+    std::cout << "Testing pivots on included letters... ";
+    PatternQuery rare;
+    rare.pattern = "????";
+    rare.include = "Q";
+    assert(search(gaddag, rare) == Words({"CINQ", "QATS"}));
+    for (const char* pattern : {"???", "????", "?????", "*", "?*", "*?", "C*", "[AEIOU]*", "*[^S]"}) {
+        for (const char* include : {"Q", "B", "AA", "QS", "NS"}) {
+            rare.pattern = pattern;
+            rare.include = include;
+            assert(search(gaddag, rare) == bruteForce(rare));
+        }
+    }
+    rare.pattern = "*";
+    rare.include = "N";
+    rare.limit = 1;
+    assert(search(gaddag, rare).size() == 1);
+    std::cout << "OK" << std::endl;
+
+    std::cout << "Testing the limit... ";
+    PatternQuery limited;
+    limited.pattern = "*";
+    limited.limit = 4;
+    assert(search(gaddag, limited).size() == 4);
+    std::cout << "OK" << std::endl;
+
+    std::cout << "All Pattern Tests Passed!" << std::endl;
+    return 0;
+}
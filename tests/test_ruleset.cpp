@@ -0,0 +1,161 @@
+#include "MoveGenerator.h"
+#include "test_support.h"
+#include "Ruleset.h"
+#include "Rules.h"
+#include "TileBag.h"
+#include <iostream>
+#include <algorithm>
+#include <tuple>
+#include <cassert>
+
+using namespace Scrabble;
+
+static Move makeMove(int row, int col, bool horizontal, const std::string& word) {
+    Move m;
+    m.row = row;
+    m.col = col;
+    m.horizontal = horizontal;
+    m.word = word;
+    m.tileCount = (int)word.size();
+    for (int i = 0; i < m.tileCount; ++i) m.tiles[i] = Tile(word[i], 1);
+    return m;
+}
+
+template <int N>
+static void place(BasicBoard<N>& board, int row, int col, const std::string& word) {
+    for (size_t i = 0; i < word.size(); ++i) board.setTile(row, col + (int)i, Tile(word[i], 1));
+}
+
+using MoveKey = std::tuple<int, int, std::string>;
+
+static std::vector<MoveKey> keys(const std::vector<Move>& moves, int limit) {
+    std::vector<MoveKey> out;
+    for (const Move& m : moves) {
+        if (m.row < limit && m.col + (int)m.word.size() <= limit) out.emplace_back(m.row, m.col, m.word);
+    }
+    std::sort(out.begin(), out.end());
+    return out;
+}
+
+void testLayouts() {
+    Board board;
+    assert(Board::SIZE == 15 && Board::CENTER == 7);
+    assert(board.getBonus(0, 0) == Bonus::TripleWord);
+    assert(board.getBonus(7, 7) == Bonus::None);
+    assert(board.getBonus(1, 5) == Bonus::TripleLetter);
+    assert(board.getBonus(14, 11) == Bonus::DoubleLetter);
+
+    SuperBoard super;
+    assert(SuperBoard::SIZE == 21 && SuperBoard::CENTER == 10);
+    assert(super.getBonus(0, 0) == Bonus::QuadrupleWord && super.getBonus(20, 20) == Bonus::QuadrupleWord);
+    assert(super.getBonus(2, 6) == Bonus::QuadrupleLetter);
+    assert(super.getBonus(21, 0) == Bonus::None);
+    for (int r = 0; r < 21; ++r) {
+        for (int c = 0; c < 21; ++c) {
+            // transposed() relies on the layout being symmetric
+            assert(super.getBonus(r, c) == super.getBonus(c, r));
+            assert(super.getBonus(r, c) == super.getBonus(20 - r, c));
+        }
+    }
+}
+
+void testTables() {
+    assert(letterValue('W') == 10 && letterValue<FrenchRules>('W') == 10);
+    assert(letterValue<EnglishRules>('W') == 4 && letterValue<SuperRules>('K') == 5);
+    assert(letterCount('E') == 15 && letterCount<EnglishRules>('E') == 12 && letterCount<SuperRules>('?') == 4);
+    assert(RACK_SIZE == FrenchRules::RACK_SIZE && BINGO_BONUS == FrenchRules::BINGO_BONUS);
+
+    TileBag bag(3, EnglishRules::COUNTS, EnglishRules::BLANKS);
+    assert(bag.size() == (size_t)bagSize<EnglishRules>());
+    std::vector<char> all;
+    bag.refill(all, 1000);
+    assert(bag.empty() && std::count(all.begin(), all.end(), 'E') == 12);
+    assert(std::count(all.begin(), all.end(), BLANK_TILE) == 2);
+    assert(TileBag(3).size() == 102);
+}
+
+void testScoring() {
+    Board board;
+    Move we = makeMove(7, 7, true, "WE");
+    assert(scoreMove(board, we) == 11);
+    assert(scoreMove<FrenchRules>(board, we) == 11);
+    assert(scoreMove<EnglishRules>(board, we) == 5);
+
+    SuperBoard super;
+    assert(scoreMove<SuperRules>(super, makeMove(0, 0, true, "ART")) == 12);    // Quadruple word
+    assert(scoreMove<SuperRules>(super, makeMove(2, 6, true, "AIR")) == 6);     // Quadruple letter under A
+    assert(scoreMove<SuperRules>(super, makeMove(10, 14, true, "RESTAIT")) == 11 + SuperRules::BINGO_BONUS);
+
+    // A move reaching past column 14 only exists on the large board
+    applyMove(super, makeMove(10, 14, true, "RESTAIT"));
+    assert(super.getTile(10, 20).letter == 'T');
+}
+
+// The same tiles on both boards, kept inside the 15x15 corner: the moves of the large
+// board that stay inside that corner are exactly the moves of the standard board
+void testGeneration(const Gaddag& gaddag) {
+    Board board;
+    SuperBoard super;
+    place(board, 7, 5, "TERRE");
+    place(super, 7, 5, "TERRE");
+    place(board, 10, 9, "NOTE");    // Covers the centre of the large board
+    place(super, 10, 9, "NOTE");
+
+    std::vector<char> rack = {'A', 'I', 'S', 'T', 'R', 'N', '?'};
+    MoveGenerator generator;
+    SuperMoveGenerator superGenerator;
+    std::vector<Move> small = generator.generateMoves(board, rack, gaddag);
+    std::vector<Move> large = superGenerator.generateMoves(super, rack, gaddag);
+    assert(!small.empty() && large.size() > small.size());
+    assert(keys(small, 15) == keys(large, 15));
+
+    // Per-thread context and vertical pass on the large board
+    SuperMoveGenerator::GenContext context;
+    assert(superGenerator.generateMoves(super, rack, gaddag, context).size() == large.size());
+    assert(!superGenerator.generateMoves(super.transposed(), rack, gaddag, context).empty());
+
+    // First move on an empty large board goes through its centre
+    SuperBoard empty;
+    std::vector<Move> opening = superGenerator.generateMoves(empty, rack, gaddag);
+    std::vector<MoveKey> reaching;
+    for (const Move& m : opening) {
+        assert(m.row == 10 && m.col <= 10 && m.col + (int)m.word.size() > 10);
+        assert(gaddag.contains(m.word));
+        if (m.col + (int)m.word.size() > 13) reaching.emplace_back(m.row, m.col, m.word);
+    }
+    std::sort(reaching.begin(), reaching.end());
+
+    // Masked generation returns the same subset
+    SuperMoveGenerator::SquareMask mask;
+    mask.set(10, 13);
+    std::vector<Move> masked = superGenerator.generateMoves(empty, rack, gaddag, mask);
+    assert(!masked.empty() && keys(masked, 21) == reaching);
+}
+
+int main() {
+    std::cout << "Starting Ruleset Test..." << std::endl;
+
+    Gaddag gaddag;
+    bool loaded = loadTestWords(gaddag, "test_ruleset_words.txt");
+    assert(loaded);
+    (void)loaded;
+
+    std::cout << "Testing board layouts... ";
+    testLayouts();
+    std::cout << "OK" << std::endl;
+
+    std::cout << "Testing ruleset tables and tile bags... ";
+    testTables();
+    std::cout << "OK" << std::endl;
+
+    std::cout << "Testing scoring per ruleset... ";
+    testScoring();
+    std::cout << "OK" << std::endl;
+
+    std::cout << "Testing generation on the 21x21 board... ";
+    testGeneration(gaddag);
+    std::cout << "OK" << std::endl;
+
+    std::cout << "All Ruleset Tests Passed!" << std::endl;
+    return 0;
+}
@@ -0,0 +1,154 @@
+#include "SelfPlay.h"
+#include "test_support.h"
+#include "Rules.h"
+#include <iostream>
+#include <cassert>
+
+using namespace Scrabble;
+
+void testTileBag() {
+    std::cout << "Testing tile bag distribution... ";
+    TileBag bag(42);
+    assert(bag.size() == 102);
+
+    std::vector<char> rack;
+    bag.refill(rack, RACK_SIZE);
+    assert(rack.size() == (size_t)RACK_SIZE);
+    assert(bag.size() == 95);
+
+    std::vector<char> swap(rack.begin(), rack.begin() + 3);
+    bool exchanged = bag.exchange(rack, swap);
+    assert(exchanged);
+    assert(rack.size() == (size_t)RACK_SIZE);
+    assert(bag.size() == 95);
+    std::cout << "PASSED" << std::endl;
+}
+
+void testScoring() {
+    std::cout << "Testing move scoring... ";
+    Board board;
+
+    // CHAT on row 7 from column 3: C on a double letter square
+    Move m;
+    m.row = 7; m.col = 3; m.horizontal = true; m.word = "CHAT";
+    std::vector<char> rack = {'C', 'H', 'A', 'T', 'E', 'S', 'U'};
+    m.tileCount = 4;
+    for (int i = 0; i < 4; ++i) m.tiles[i] = Tile(m.word[i], 1);
+    bool resolved = resolveTiles(m, rack);
+    assert(resolved);
+    assert(scoreMove(board, m) == 3 * 2 + 4 + 1 + 1);
+    applyMove(board, m);
+
+    // Hooking S under T forms TS vertically; (8,6) is a double letter but the S is a blank
+    Move hook;
+    hook.row = 7; hook.col = 6; hook.horizontal = false; hook.word = "TS";
+    hook.tileCount = 1;
+    hook.tiles[0] = Tile('S', 0); // Blank S scores nothing
+    assert(scoreMove(board, hook) == 1);
+
+    assert(boardToString(boardFromString(boardToString(board))) == boardToString(board));
+    std::cout << "PASSED" << std::endl;
+}
+
+void testBlankPlacement() {
+    std::cout << "Testing blank placement... ";
+    Board board;
+
+    // TATA on row 7 from column 8 with one A and a blank: the second A sits on
+    // the double letter square at column 11, so the blank belongs on the first
+    Move m;
+    m.row = 7; m.col = 8; m.horizontal = true; m.word = "TATA";
+    std::vector<char> rack = {'T', 'T', 'A', '?'};
+    m.tileCount = 4;
+    for (int i = 0; i < 4; ++i) m.tiles[i] = Tile(m.word[i], 1);
+    bool resolved = resolveAndScore(board, m, rack);
+    assert(resolved);
+    assert(m.tiles[1].value == 0 && m.tiles[3].value == 1);
+    assert(m.score == 1 + 0 + 1 + 1 * 2);
+    assert(m.score == scoreMove(board, m));
+
+    // Only blanks left for a letter: nothing to move
+    std::vector<char> blanks = {'T', 'T', '?', '?'};
+    for (int i = 0; i < 4; ++i) m.tiles[i] = Tile(m.word[i], 1);
+    resolved = resolveAndScore(board, m, blanks);
+    assert(resolved);
+    assert(m.score == 1 + 1);
+
+    std::vector<char> shortRack = {'T', 'A', '?'};
+    for (int i = 0; i < 4; ++i) m.tiles[i] = Tile(m.word[i], 1);
+    assert(!resolveAndScore(board, m, shortRack));
+    (void)resolved;
+    std::cout << "PASSED" << std::endl;
+}
+
+void testSelfPlayGame(const Gaddag& gaddag) {
+    std::cout << "Testing self-play game... ";
+    MoveGenerator generator;
+    GreedyPolicy greedy;
+    MovePolicy* policies[Game::NUM_PLAYERS] = {&greedy, &greedy};
+
+    SelfPlayStats stats;
+    Game game(7);
+    playGame(game, policies, generator, gaddag, stats);
+    assert(game.isOver());
+    assert(stats.games == 1);
+    assert(stats.plays > 0);
+
+    // Tile conservation: board + racks + bag = full set
+    size_t onBoard = 0;
+    for (int r = 0; r < 15; ++r)
+        for (int c = 0; c < 15; ++c)
+            if (!game.getBoard().isEmpty(r, c)) onBoard++;
+    size_t total = onBoard + game.bagSize();
+    for (int p = 0; p < Game::NUM_PLAYERS; ++p) total += game.getRack(p).size();
+    assert(total == 102);
+
+    // Same seed, same game
+    Game replay(7);
+    SelfPlayStats replayStats;
+    playGame(replay, policies, generator, gaddag, replayStats);
+    assert(replay.getScore(0) == game.getScore(0));
+    assert(replay.getScore(1) == game.getScore(1));
+    std::cout << "PASSED" << std::endl;
+}
+
+void testConcurrentRun(const Gaddag& gaddag) {
+    std::cout << "Testing concurrent self-play run... ";
+    SelfPlayConfig config;
+    config.games = 8;
+    config.threads = 4;
+    config.seed = 3;
+    config.policies[0] = policyByName("greedy");
+    config.policies[1] = policyByName("random");
+    SelfPlayStats stats = runSelfPlay(gaddag, config);
+    assert(stats.games == 8);
+    assert(stats.turns >= stats.plays);
+
+    // Random policies replay identically whatever the thread count
+    for (int threads : {1, 3}) {
+        config.threads = threads;
+        SelfPlayStats again = runSelfPlay(gaddag, config);
+        assert(again.totalScore == stats.totalScore && again.plays == stats.plays && again.turns == stats.turns);
+    }
+    std::cout << "PASSED" << std::endl;
+}
+
+int main() {
+    std::cout << "Starting Self-Play Test..." << std::endl;
+
+    Gaddag gaddag;
+    bool loaded = loadTestWords(gaddag, "test_selfplay_words.txt");
+    if (!loaded) {
+        std::cerr << "FAILED: Could not load test word list" << std::endl;
+        return 1;
+    }
+
+    testTileBag();
+    testScoring();
+    testBlankPlacement();
+    testSelfPlayGame(gaddag);
+    testConcurrentRun(gaddag);
+
+    std::cout << "PASSED: All self-play tests passed." << std::endl;
+    return 0;
+}
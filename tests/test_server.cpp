@@ -0,0 +1,172 @@
+#include "Server.h"
+#include "test_support.h"
+#include "Rules.h"
+#include <iostream>
+#include <string>
+#include <thread>
+#include <chrono>
+#include <cassert>
+#include <cstring>
+#include <csignal>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+
+using namespace Scrabble;
+
+static const std::string EMPTY_BOARD(225, '.');
+
+// Read everything until the other side closes
+static std::string readAll(int fd) {
+    std::string out;
+    char buf[4096];
+    ssize_t n;
+    while ((n = ::read(fd, buf, sizeof(buf))) > 0) out.append(buf, (size_t)n);
+    return out;
+}
+
+static size_t countLines(const std::string& s) {
+    size_t n = 0;
+    for (char c : s) n += (c == '\n');
+    return n;
+}
+
+int main() {
+    std::cout << "Starting Server Test..." << std::endl;
+    std::signal(SIGPIPE, SIG_IGN);
+
+    Gaddag gaddag;
+    bool loaded = loadWords(gaddag, "test_server_words.txt", SMALL_WORDS);
+    assert(loaded);
+
+    SolverServer server(gaddag, 2);
+    MoveGenerator generator;
+
+    std::cout << "Testing request parsing... ";
+    SolverRequest request;
+    std::string error;
+    assert(parseRequest(EMPTY_BOARD + " | chat?", request, error));
+    assert(request.rack == "CHAT?" && request.mode == RequestMode::All);
+    assert(parseRequest(EMPTY_BOARD + " | CHATS | top 3", request, error));
+    assert(request.mode == RequestMode::TopK && request.k == 3);
+    assert(!parseRequest("...|CHAT", request, error));
+    assert(!parseRequest(EMPTY_BOARD + " | CHATSXYZ", request, error));
+    assert(!parseRequest(EMPTY_BOARD + " | CHAT | top 0", request, error));
+    assert(!parseRequest(EMPTY_BOARD + " | CHAT | best", request, error));
+    assert(parseRequest(EMPTY_BOARD + " | CHATS | top 3 within 2.5", request, error));
+    assert(request.mode == RequestMode::TopK && request.withinMs == 2.5);
+    assert(!parseRequest(EMPTY_BOARD + " | CHATS | all within 0", request, error));
+    assert(!parseRequest(EMPTY_BOARD + " | CHATS | top 3 soon", request, error));
+    std::cout << "OK" << std::endl;
+
+    std::cout << "Testing modes... ";
+    std::string all = server.handle(EMPTY_BOARD + " | CHATS", generator);
+    assert(all.compare(0, 3, "OK ") == 0);
+    size_t total = (size_t)std::stoul(all.substr(3));
+    assert(total > 3 && countLines(all) == total + 1);
+
+    std::string top = server.handle(EMPTY_BOARD + " | CHATS | top 3", generator);
+    assert(top.compare(0, 5, "OK 3\n") == 0 && countLines(top) == 4);
+    // The best move comes first in both answers
+    std::string firstAll = all.substr(all.find('\n') + 1, all.find('\n', all.find('\n') + 1) - all.find('\n'));
+    std::string firstTop = top.substr(top.find('\n') + 1, top.find('\n', top.find('\n') + 1) - top.find('\n'));
+    assert(firstAll == firstTop);
+    // A generous deadline gives the full answer
+    assert(server.handle(EMPTY_BOARD + " | CHATS | top 3 within 10000", generator) == top);
+
+    // CHATS across the centre, validated through its placement string
+    std::string placement = EMPTY_BOARD;
+    placement.replace(7 * 15 + 3, 5, "CHATS");
+    std::string valid = server.handle(EMPTY_BOARD + " | CHATS | validate " + placement, generator);
+    assert(valid.compare(0, 5, "OK 1\n") == 0);
+    assert(valid.find("| 7 3 H CHATS") != std::string::npos);
+    // Same word with a blank S
+    placement[7 * 15 + 7] = 's';
+    valid = server.handle(EMPTY_BOARD + " | CHAT? | validate " + placement, generator);
+    assert(valid.compare(0, 5, "OK 1\n") == 0);
+    // The rack cannot supply it
+    placement[7 * 15 + 7] = 'S';
+    assert(server.handle(EMPTY_BOARD + " | CHAT | validate " + placement, generator) == "ERR illegal move: not_in_rack\n");
+    assert(server.handle("garbage", generator).compare(0, 4, "ERR ") == 0);
+    std::cout << "OK" << std::endl;
+
+    std::cout << "Testing pipelined stream... ";
+    {
+        int requests[2];
+        int responses[2];
+        bool piped = ::pipe(requests) == 0 && ::pipe(responses) == 0;
+        assert(piped);
+        std::thread connection([&]() {
+            server.serve(requests[0], responses[1]);
+            ::close(responses[1]);
+        });
+
+        // Write every request before reading anything back
+        std::string batch;
+        batch += EMPTY_BOARD + " | CHATS | top 3\n";
+        batch += "garbage\n";
+        batch += EMPTY_BOARD + " | CHATS | top 1\n";
+        batch += EMPTY_BOARD + " | CHATS | top 2";  // No trailing newline
+        ssize_t written = ::write(requests[1], batch.data(), batch.size());
+        assert(written == (ssize_t)batch.size());
+        ::close(requests[1]);
+
+        std::string out = readAll(responses[0]);
+        connection.join();
+        ::close(requests[0]);
+        ::close(responses[0]);
+
+        // Answers come back in request order
+        assert(out.compare(0, 5, "OK 3\n") == 0);
+        size_t err = out.find("ERR ");
+        size_t one = out.find("OK 1\n");
+        size_t two = out.find("OK 2\n");
+        assert(err != std::string::npos && one > err && two > one);
+        assert(countLines(out) == 4 + 1 + 2 + 3);
+        (void)written;
+        (void)err;
+    }
+    std::cout << "OK" << std::endl;
+
+    std::cout << "Testing Unix socket... ";
+    {
+        std::string socketPath = "test_server.sock";
+        bool listening = true;
+        std::thread listener([&]() { listening = server.listenUnix(socketPath); });
+
+        sockaddr_un addr;
+        std::memset(&addr, 0, sizeof(addr));
+        addr.sun_family = AF_UNIX;
+        std::strncpy(addr.sun_path, socketPath.c_str(), sizeof(addr.sun_path) - 1);
+        // Sequential connections: the threads of closed ones are joined as new ones arrive
+        for (int round = 0; round < 4; ++round) {
+            int client = -1;
+            for (int attempt = 0; attempt < 200 && client < 0; ++attempt) {
+                int fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+                if (::connect(fd, (sockaddr*)&addr, sizeof(addr)) == 0) {
+                    client = fd;
+                } else {
+                    ::close(fd);
+                    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+                }
+            }
+            assert(client >= 0);
+
+            std::string line = EMPTY_BOARD + " | CHATS | top 2\nquit\n";
+            ssize_t written = ::write(client, line.data(), line.size());
+            assert(written == (ssize_t)line.size());
+            std::string out = readAll(client);
+            ::close(client);
+            assert(out.compare(0, 5, "OK 2\n") == 0 && countLines(out) == 3);
+            (void)written;
+        }
+
+        server.stopListening();
+        listener.join();
+        assert(listening);
+    }
+    std::cout << "OK" << std::endl;
+
+    std::cout << "PASSED: All server tests passed." << std::endl;
+    return 0;
+}
@@ -0,0 +1,148 @@
+#include "SuccinctGaddag.h"
+#include "test_support.h"
+#include "Rules.h"
+#include <iostream>
+#include <fstream>
+#include <cassert>
+#include <cstdio>
+#include <cstring>
+
+using namespace Scrabble;
+
+void testLookup(const Gaddag& gaddag, const SuccinctGaddag& succinct) {
+    assert(succinct.nodeCount() == countNodes(gaddag.getRoot()));
+    assert(succinct.wordCount() == TEST_WORD_COUNT);
+    for (const char* w : TEST_WORDS) {
+        assert(succinct.contains(w));
+        std::string word(w);
+        assert(!succinct.contains(word + "Q") && !succinct.contains(word.substr(1) + "Q"));
+    }
+    assert(succinct.contains("restait"));
+    assert(!succinct.contains("") && !succinct.contains("TRAI") && !succinct.contains("XYZ"));
+
+    // Same children, in the same order, along every path of the pointer GADDAG
+    std::vector<std::pair<const Node*, SuccinctGaddag::Cursor>> stack = {{gaddag.rootCursor(), succinct.rootCursor()}};
+    while (!stack.empty()) {
+        const Node* node = stack.back().first;
+        SuccinctGaddag::Cursor cursor = stack.back().second;
+        stack.pop_back();
+        assert(Gaddag::isTerminal(node) == succinct.isTerminal(cursor));
+        size_t children = 0;
+        succinct.forEachChild(cursor, [&](char letter, SuccinctGaddag::Cursor next) {
+            const Node* expected = nullptr;
+            assert(Gaddag::child(node, letter, expected));
+            SuccinctGaddag::Cursor found = 0;
+            assert(succinct.child(cursor, letter, found) && found == next);
+            stack.emplace_back(expected, next);
+            children++;
+        });
+        assert(children == node->children.size());
+    }
+}
+
+// Plays greedy games and checks every turn against the pointer GADDAG
+void testGames(const Gaddag& gaddag, const SuccinctGaddag& succinct) {
+    MoveGenerator generator;
+    GenContext context;
+    playGreedyGames(gaddag, 17, [&](uint64_t, const Game& game, const std::vector<Move>& plain) {
+        const Board& board = game.getBoard();
+        const std::vector<char>& rack = game.getRack(game.currentPlayer());
+        assert(sameMoves(plain, generateScoredMoves(board, rack, generator, succinct, context)));
+
+        // Both orientations, as the generator sees them
+        for (const Board& view : {board, board.transposed()}) {
+            uint32_t expected[15][15], found[15][15];
+            generator.computeCrossChecks(view, gaddag, expected);
+            generator.computeCrossChecks(view, succinct, found);
+            for (int r = 0; r < 15; ++r) {
+                for (int c = 0; c < 15; ++c) assert(expected[r][c] == found[r][c]);
+            }
+        }
+    });
+}
+
+void testFiles(const SuccinctGaddag& succinct) {
+    std::string path = "test_succinct_gaddag.bin";
+    assert(succinct.saveBinary(path));
+    SuccinctGaddag loaded;
+    assert(loaded.loadBinary(path));
+    assert(loaded.nodeCount() == succinct.nodeCount() && loaded.wordCount() == succinct.wordCount());
+    assert(loaded.bytes() == succinct.bytes());
+    for (const char* w : TEST_WORDS) assert(loaded.contains(w));
+
+    std::string data;
+    {
+        std::ifstream in(path, std::ios::binary);
+        data.assign((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    }
+    auto write = [&path](const std::string& bytes) {
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        out.write(bytes.data(), (std::streamsize)bytes.size());
+    };
+    // Header: magic (8), nodes, words, bits (8), then the word counts of each array
+    uint32_t loudsWords, rankCount, selectCount;
+    std::memcpy(&loudsWords, &data[24], 4);
+    std::memcpy(&rankCount, &data[28], 4);
+    std::memcpy(&selectCount, &data[32], 4);
+    const size_t loudsAt = 48, rankAt = loudsAt + loudsWords * 8, labelsAt = rankAt + (rankCount + selectCount) * 4;
+
+    // Stored rank samples are ignored: a bad one does not change lookups
+    std::string bytes = data;
+    bytes[rankAt + 4 * (rankCount - 1)] ^= 0x7F;
+    write(bytes);
+    assert(loaded.loadBinary(path));
+    for (const char* w : TEST_WORDS) assert(loaded.contains(w));
+
+    // Malformed files are rejected, and the dictionary is left empty
+    std::vector<std::string> corrupt;
+    corrupt.push_back(data.substr(0, data.size() / 2));     // Truncated
+    corrupt.push_back(data);
+    corrupt.back()[loudsAt] ^= 0x04;                        // One edge more or less
+    corrupt.push_back(data);
+    corrupt.back()[labelsAt] |= 0x1F;                       // Label outside the alphabet
+    corrupt.push_back(data);
+    corrupt.back()[43] = 0x7F;                              // Huge terminal array
+    for (const std::string& c : corrupt) {
+        write(c);
+        assert(!loaded.loadBinary(path));
+        assert(loaded.nodeCount() == 1 && loaded.wordCount() == 0 && !loaded.contains("AS"));
+    }
+    std::remove(path.c_str());
+
+    assert(!loaded.loadBinary("missing_succinct_gaddag.bin"));
+}
+
+int main() {
+    std::cout << "Starting Succinct GADDAG Test..." << std::endl;
+
+    Gaddag gaddag;
+    bool loaded = loadTestWords(gaddag, "test_succinct_gaddag_words.txt");
+    assert(loaded);
+    (void)loaded;
+
+    SuccinctGaddag succinct(gaddag);
+
+    std::cout << "Testing lookups and structure... ";
+    testLookup(gaddag, succinct);
+    std::cout << "OK (" << succinct.nodeCount() << " nodes, " << succinct.bytes() << " bytes)" << std::endl;
+
+    std::cout << "Testing generation against the pointer GADDAG... ";
+    testGames(gaddag, succinct);
+    std::cout << "OK" << std::endl;
+
+    std::cout << "Testing save and load... ";
+    testFiles(succinct);
+    std::cout << "OK" << std::endl;
+
+    std::cout << "Testing the empty dictionary... ";
+    SuccinctGaddag empty;
+    assert(empty.nodeCount() == 1 && !empty.contains("AS"));
+    Board board;
+    MoveGenerator generator;
+    GenContext context;
+    assert(generator.generateMoves(board, {'A', 'S', 'E'}, empty, context).empty());
+    std::cout << "OK" << std::endl;
+
+    std::cout << "All Succinct GADDAG Tests Passed!" << std::endl;
+    return 0;
+}
@@ -0,0 +1,97 @@
+#ifndef TEST_SUPPORT_H
+#define TEST_SUPPORT_H
+
+// Helpers shared by the tests: word lists and their dictionary fixture, move comparison, greedy games
+
+#include "Game.h"
+#include "SelfPlay.h"
+#include <fstream>
+#include <string>
+#include <vector>
+#include <cstdio>
+
+namespace Scrabble {
+
+    // Small self-contained word list so tests do not depend on the full dictionary
+    inline const char* const TEST_WORDS[] = {
+        "AS", "AU", "DE", "DU", "EN", "ES", "ET", "EU", "IL", "LA", "LE", "LU", "MA", "ME",
+        "MI", "MU", "NE", "NI", "NU", "ON", "OR", "OU", "PU", "RE", "RI", "SA", "SE", "SI",
+        "TA", "TE", "TU", "UN", "VA", "VU", "AIR", "AME", "ANS", "ART", "EST", "ETE", "LIT",
+        "LOI", "MER", "MOT", "NEZ", "NID", "NOS", "NUE", "OSE", "RAT", "RIS", "RUE", "SEL",
+        "SOL", "SUR", "TAS", "TOI", "UNE", "AIDE", "AIRE", "DIRE", "ETAT", "LAIT", "LIRE",
+        "MERE", "NOTE", "RIEN", "RIRE", "ROUE", "RUES", "SAIN", "SOIR", "TENU", "TIRE",
+        "TOUR", "TRIS", "ARETE", "LITRE", "NOTER", "OSIER", "RENTE", "SATIN", "TERRE",
+        "TRAIN", "TRIER", "USINE", "SORTIE", "RESTAIT", "TRAINES"
+    };
+
+    inline const size_t TEST_WORD_COUNT = sizeof(TEST_WORDS) / sizeof(TEST_WORDS[0]);
+
+    // Short list around CHAT, for tests that check exact moves or placements by hand
+    inline const char* const SMALL_WORDS[] = {
+        "CHAT", "CHATS", "AS", "TA", "AH", "HA", "TE", "ET", "ES", "SE", "LA", "LE", "EN", "NE",
+        "UN", "IL", "ILE", "SEL", "TES", "RAT", "RATS", "MER", "MERE", "LIT", "SALE", "TALE", "SEAU"
+    };
+
+    // Load a word list through a temporary word file named after the test
+    template <typename Words>
+    bool loadWords(Gaddag& gaddag, const std::string& path, const Words& words) {
+        {
+            std::ofstream out(path);
+            for (const auto& w : words) out << w << "\n";
+        }
+        bool loaded = gaddag.loadFromFile(path);
+        std::remove(path.c_str());
+        return loaded;
+    }
+
+    inline bool loadTestWords(Gaddag& gaddag, const std::string& path) {
+        return loadWords(gaddag, path, TEST_WORDS);
+    }
+
+    // Same moves in the same order (generateScoredMoves sorts its result)
+    inline bool sameMoves(const std::vector<Move>& a, const std::vector<Move>& b) {
+        if (a.size() != b.size()) return false;
+        for (size_t i = 0; i < a.size(); ++i) {
+            if (a[i].row != b[i].row || a[i].col != b[i].col || a[i].horizontal != b[i].horizontal ||
+                a[i].word != b[i].word || a[i].score != b[i].score || a[i].tileCount != b[i].tileCount) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    inline int bestMove(const std::vector<Move>& moves) {
+        int best = 0;
+        for (int i = 1; i < (int)moves.size(); ++i) {
+            if (moves[i].score > moves[best].score) best = i;
+        }
+        return best;
+    }
+
+    inline size_t countNodes(const Node* node) {
+        size_t count = 1;
+        for (const auto& child : node->children) count += countNodes(child.second);
+        return count;
+    }
+
+    /**
+     * Play 6 seeded greedy games, calling turn(gameIndex, game, moves) before each move,
+     * where moves is plain generation on the full dictionary.
+     * @param seed Games are Game(gameSeed(seed, index))
+     */
+    template <typename Turn>
+    void playGreedyGames(const Gaddag& gaddag, uint64_t seed, Turn turn) {
+        MoveGenerator generator;
+        for (uint64_t g = 0; g < 6; ++g) {
+            Game game(gameSeed(seed, g));
+            while (!game.isOver()) {
+                std::vector<Move> plain = game.legalMoves(generator, gaddag);
+                turn(g, game, plain);
+                if (plain.empty() || !game.play(plain[bestMove(plain)])) game.pass();
+            }
+        }
+    }
+
+}
+
+#endif // TEST_SUPPORT_H
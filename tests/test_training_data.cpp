@@ -0,0 +1,151 @@
+#include "TrainingData.h"
+#include "Rules.h"
+#include <iostream>
+#include <cassert>
+#include <cstring>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <thread>
+#include <vector>
+
+using namespace Scrabble;
+
+static const int THREADS = 4;
+static const int GAMES_PER_THREAD = 25;
+static const int POSITIONS_PER_GAME = 7;
+static const int MOVES_PER_POSITION = 5;
+
+// Deterministic synthetic game: every field is derived from (game, position, move)
+static GameRecord makeGame(uint32_t game) {
+    GameRecord rec;
+    for (int p = 0; p < POSITIONS_PER_GAME; ++p) {
+        PositionRecord pos;
+        std::memset(&pos, 0, sizeof(pos));
+        pos.board[p] = (uint8_t)(game % 26 + 1);
+        pos.rack[26] = (uint8_t)(p % 3);
+        pos.gameId = game;
+        pos.turn = (uint16_t)p;
+        pos.player = (uint8_t)(p % 2);
+        pos.scores[0] = (int16_t)(game + p);
+        pos.outcome = (int16_t)(p % 2 ? -(int)game : (int)game);
+        uint32_t posIndex = (uint32_t)rec.positions.size();
+        rec.positions.push_back(pos);
+
+        for (int m = 0; m < MOVES_PER_POSITION; ++m) {
+            Move move;
+            move.row = p;
+            move.col = m;
+            move.horizontal = (m % 2) == 0;
+            move.word = "TEST";
+            move.score = (int)(game * 10 + m);
+            move.tileCount = 1;
+            move.tiles[0] = Tile('T', 1);
+            std::vector<char> rack = {'T', 'E', 'S', '?'};
+            rec.moves.push_back(makeMoveRecord(move, rack, posIndex, m == 0));
+        }
+    }
+    return rec;
+}
+
+int main() {
+    std::cout << "Starting Training Data Test..." << std::endl;
+    std::string path = "test_training_data.td";
+
+    // Small chunks so the file spans many chunks of both tables
+    TrainingWriter writer;
+    bool opened = writer.open(path, 16, 4);
+    assert(opened);
+
+    std::vector<std::thread> producers;
+    for (int t = 0; t < THREADS; ++t) {
+        producers.emplace_back([&writer, t]() {
+            for (int g = 0; g < GAMES_PER_THREAD; ++g) {
+                writer.submit(makeGame((uint32_t)(t * GAMES_PER_THREAD + g)));
+            }
+        });
+    }
+    for (std::thread& th : producers) th.join();
+    bool closed = writer.close();
+    assert(closed);
+
+    TrainingReader reader;
+    bool mapped = reader.open(path);
+    assert(mapped);
+    const uint64_t games = THREADS * GAMES_PER_THREAD;
+    assert(reader.positionCount() == games * POSITIONS_PER_GAME);
+    assert(reader.moveCount() == games * POSITIONS_PER_GAME * MOVES_PER_POSITION);
+
+    // Games arrive in any order, but each game's rows stay contiguous and consistent
+    std::cout << "Checking " << reader.moveCount() << " move rows... ";
+    for (uint64_t i = 0; i < reader.moveCount(); ++i) {
+        MoveRecord m;
+        PositionRecord p;
+        bool found = reader.readMove(i, m) && reader.readPosition(m.position, p);
+        assert(found);
+
+        int moveInPosition = (int)(i % MOVES_PER_POSITION);
+        assert(m.features[FeatureRow] == p.turn);
+        assert(m.features[FeatureCol] == moveInPosition);
+        assert(m.score == (int16_t)(p.gameId * 10 + moveInPosition));
+        assert(m.chosen == (moveInPosition == 0 ? 1 : 0));
+        assert(std::memcmp(m.word, "TEST", 4) == 0);
+        assert(m.leave['T' - 'A'] == 0 && m.leave['E' - 'A'] == 1 && m.leave[26] == 1);
+        assert(p.board[p.turn] == (uint8_t)(p.gameId % 26 + 1));
+    }
+    std::cout << "PASSED" << std::endl;
+
+    // Out-of-range rows are rejected
+    assert(reader.column(TrainingTable::Moves, (int)MoveColumn::Score, reader.moveCount()) == nullptr);
+
+    reader.close();
+
+    std::cout << "Testing corrupt files... ";
+    std::vector<char> bytes;
+    {
+        std::ifstream in(path, std::ios::binary);
+        bytes.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+    }
+    // Footer: index offset (8), chunk count (4), chunk rows (4), positions (8), moves (8)
+    uint64_t indexOffset;
+    std::memcpy(&indexOffset, &bytes[bytes.size() - 32], 8);
+    // Index entry: table (4), rows (4), first row (8), offset (8)
+    const size_t entryRows = indexOffset + 4, entryFirstRow = indexOffset + 8, entryOffset = indexOffset + 16;
+    struct Corruption { size_t at; uint64_t value; size_t width; };
+    const Corruption corruptions[] = {
+        {bytes.size() - 24, 100000, 4},      // more chunks than the index holds
+        {bytes.size() - 20, 0, 4},           // no rows per chunk
+        {indexOffset, 7, 4},                 // unknown table
+        {entryRows, 17, 4},                  // more rows than a chunk holds
+        {entryFirstRow, 3, 8},               // gap in the row numbers
+        {entryOffset, indexOffset - 8, 8}    // chunk overlaps the index
+    };
+    std::string corruptPath = "test_training_data_corrupt.td";
+    for (const Corruption& c : corruptions) {
+        std::vector<char> copy = bytes;
+        std::memcpy(&copy[c.at], &c.value, c.width);
+        {
+            std::ofstream out(corruptPath, std::ios::binary);
+            out.write(copy.data(), copy.size());
+        }
+        assert(!reader.open(corruptPath));
+    }
+    {
+        // Truncated: the footer no longer describes the file
+        std::ofstream out(corruptPath, std::ios::binary);
+        out.write(bytes.data(), bytes.size() / 2);
+    }
+    assert(!reader.open(corruptPath));
+    std::remove(corruptPath.c_str());
+    std::remove(path.c_str());
+    std::cout << "OK" << std::endl;
+
+    std::cout << "Testing submit after close... ";
+    TrainingWriter unopened;
+    assert(!unopened.submit(makeGame(0)));
+    assert(!writer.submit(makeGame(0)));
+    std::cout << "OK" << std::endl;
+
+    std::cout << "PASSED: All training data tests passed." << std::endl;
+    return 0;
+}
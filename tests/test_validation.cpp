@@ -0,0 +1,111 @@
+#include "Validation.h"
+#include "test_support.h"
+#include "Game.h"
+#include "Rules.h"
+#include "Server.h"
+#include <iostream>
+#include <string>
+#include <cassert>
+
+using namespace Scrabble;
+
+static const std::string EMPTY_BOARD(225, '.');
+
+static std::string place(const std::string& base, int row, int col, bool horizontal, const std::string& letters) {
+    std::string placement = base;
+    for (size_t i = 0; i < letters.size(); ++i) {
+        int r = row + (horizontal ? 0 : (int)i);
+        int c = col + (horizontal ? (int)i : 0);
+        placement[r * 15 + c] = letters[i];
+    }
+    return placement;
+}
+
+int main() {
+    std::cout << "Starting Validation Test..." << std::endl;
+
+    Gaddag gaddag;
+    bool loaded = loadWords(gaddag, "test_validation_words.txt", SMALL_WORDS);
+    assert(loaded);
+
+    std::cout << "Testing lexicon lookup... ";
+    assert(isWord(gaddag, "CHAT", 4) && isWord(gaddag, "CHATS", 5));
+    assert(!isWord(gaddag, "CHA", 3) && !isWord(gaddag, "HATS", 4) && !isWord(gaddag, "", 0));
+    std::cout << "OK" << std::endl;
+
+    Board empty;
+    std::cout << "Testing the opening move... ";
+    MoveValidation v = validateMove(empty, place(EMPTY_BOARD, 7, 3, true, "CHATS"), gaddag);
+    assert(v.ok());
+    assert(v.move.row == 7 && v.move.col == 3 && v.move.horizontal && v.move.word == "CHATS");
+    assert(v.words.size() == 1 && v.score == scoreMove(empty, v.move));
+    // A blank S is worth nothing
+    MoveValidation blank = validateMove(empty, place(EMPTY_BOARD, 7, 3, true, "CHATs"), gaddag);
+    assert(blank.ok() && blank.move.tiles[4].isBlank() && blank.score < v.score);
+    assert(blank.score == scoreMove(empty, blank.move));
+    assert(validateMove(empty, place(EMPTY_BOARD, 4, 7, false, "CHAT"), gaddag).ok());
+    std::cout << "OK" << std::endl;
+
+    std::cout << "Testing geometry errors... ";
+    assert(validateMove(empty, "CHAT", gaddag).error == MoveError::BadPlacement);
+    assert(validateMove(empty, place(EMPTY_BOARD, 7, 3, true, "CH4T"), gaddag).error == MoveError::BadPlacement);
+    assert(validateMove(empty, EMPTY_BOARD, gaddag).error == MoveError::EmptyPlacement);
+    assert(validateMove(empty, place(EMPTY_BOARD, 7, 3, true, "CHATSASE"), gaddag).error == MoveError::TooManyTiles);
+    assert(validateMove(empty, place(EMPTY_BOARD, 0, 0, true, "CHAT"), gaddag).error == MoveError::MissingCenter);
+    assert(validateMove(empty, place(EMPTY_BOARD, 7, 7, true, "C"), gaddag).error == MoveError::TooShort);
+    std::string diagonal = place(EMPTY_BOARD, 7, 7, true, "A");
+    diagonal[8 * 15 + 8] = 'S';
+    assert(validateMove(empty, diagonal, gaddag).error == MoveError::NotInLine);
+    MoveValidation gap = validateMove(empty, place(EMPTY_BOARD, 7, 5, true, "CH.T"), gaddag);
+    assert(gap.error == MoveError::Gap && gap.detail == "7 7");
+    std::cout << "OK" << std::endl;
+
+    Board board = empty;
+    applyMove(board, v.move);  // CHATS on row 7, columns 3-7
+    std::cout << "Testing moves on a board... ";
+    assert(validateMove(board, place(EMPTY_BOARD, 7, 4, true, "A"), gaddag).error == MoveError::OccupiedSquare);
+    assert(validateMove(board, place(EMPTY_BOARD, 0, 0, true, "TA"), gaddag).error == MoveError::NotConnected);
+    // AS down from the A of CHATS, then a single S that only forms a word vertically
+    MoveValidation down = validateMove(board, place(EMPTY_BOARD, 8, 5, false, "S"), gaddag);
+    assert(down.ok() && !down.move.horizontal && down.move.word == "AS" && down.move.row == 7 && down.move.col == 5);
+    assert(down.score == scoreMove(board, down.move));
+    // Extending CHAT to CHATS is a single tile in the main direction
+    MoveValidation bad = validateMove(board, place(EMPTY_BOARD, 8, 3, true, "TAS"), gaddag);
+    assert(bad.error == MoveError::InvalidWord && bad.detail == "TAS");
+    MoveValidation cross = validateMove(board, place(EMPTY_BOARD, 8, 2, true, "TA"), gaddag);
+    assert(cross.error == MoveError::InvalidWord);
+    std::cout << "OK" << std::endl;
+
+    std::cout << "Testing the rack check... ";
+    std::string chats = place(EMPTY_BOARD, 7, 3, true, "CHATS");
+    assert(validateMove(empty, chats, gaddag, {'C', 'H', 'A', 'T', 'S'}).ok());
+    assert(validateMove(empty, chats, gaddag, {'C', 'H', 'A', 'T', '?'}).error == MoveError::NotInRack);
+    assert(validateMove(empty, place(EMPTY_BOARD, 7, 3, true, "CHATs"), gaddag, {'C', 'H', 'A', 'T', '*'}).ok());
+    assert(validateMove(empty, chats, gaddag, {'C', 'H', 'A', 'T'}).error == MoveError::NotInRack);
+    std::cout << "OK" << std::endl;
+
+    std::cout << "Testing agreement with the generator... ";
+    MoveGenerator generator;
+    size_t checked = 0;
+    for (uint64_t seed = 1; seed <= 4; ++seed) {
+        Game game(seed);
+        for (int turn = 0; turn < 12 && !game.isOver(); ++turn) {
+            const Board& current = game.getBoard();
+            const std::vector<char>& rack = game.getRack(game.currentPlayer());
+            std::vector<Move> moves = game.legalMoves(generator, gaddag);
+            for (const Move& m : moves) {
+                MoveValidation check = validateMove(current, placementString(current, m), gaddag, rack);
+                assert(check.ok() && check.score == m.score);
+                (void)check;
+                checked++;
+            }
+            if (moves.empty()) game.pass();
+            else game.play(moves[0]);
+        }
+    }
+    assert(checked > 0);
+    std::cout << "OK (" << checked << " moves)" << std::endl;
+
+    std::cout << "All Validation Tests Passed!" << std::endl;
+    return 0;
+}